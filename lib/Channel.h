@@ -51,8 +51,28 @@ namespace otairedis
                     _In_ const std::string& key,
                     _In_ const std::string& command) = 0;
 
+            /**
+             * @brief Send request which expects response.
+             *
+             * Request is tagged with new correlation id and sent immediately,
+             * even in buffered mode.
+             *
+             * @return Correlation id which must be passed to wait.
+             */
+            virtual uint64_t request(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command) = 0;
+
+            /**
+             * @brief Wait for response to request with given correlation id.
+             *
+             * Can be called from multiple threads at the same time, each
+             * thread receives only its own response.
+             */
             virtual otai_status_t wait(
                     _In_ const std::string& command,
+                    _In_ uint64_t correlationId,
                     _Out_ swss::KeyOpFieldsValuesTuple& kco) = 0;
 
         protected:
@@ -37,6 +37,7 @@ otai_status_t Otai::initialize(
         _In_ const otai_service_method_table_t *service_method_table)
 {
     MUTEX();
+    CONTEXT_EXCLUSIVE();
     SWSS_LOG_ENTER();
 
     if (m_apiInitialized)
@@ -73,6 +74,7 @@ otai_status_t Otai::initialize(
 
 otai_status_t Otai::uninitialize(void)
 {
+    CONTEXT_EXCLUSIVE();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
@@ -135,6 +137,10 @@ otai_status_t Otai::set(
 
     if (RedisRemoteOtaiInterface::isRedisAttribute(objectType, attr))
     {
+        // extension attribute can clear local state or replace channel
+
+        CONTEXT_EXCLUSIVE();
+
         // skip metadata if attribute is redis extension attribute
 
         // TODO this is setting on all contexts, but maybe we want one specific?
@@ -162,10 +168,14 @@ otai_status_t Otai::get(
         _In_ uint32_t attr_count,
         _Inout_ otai_attribute_t *attr_list)
 {
-    MUTEX();
+    CONTEXT_SHARED();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
+    // get is not taking api mutex, meta keeps no state and channel matches
+    // responses by correlation id, so slow get is not blocking other threads,
+    // context lock only keeps context alive against uninitialize
+
     return m_context->m_meta->get(
             objectType,
             objectId,
@@ -173,10 +183,64 @@ otai_status_t Otai::get(
             attr_list);
 }
 
+// BULK QUAD OID
+
+otai_status_t Otai::bulkCreate(
+        _In_ otai_object_type_t objectType,
+        _In_ otai_object_id_t linecardId,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const otai_attribute_t **attr_list,
+        _Out_ otai_object_id_t *object_id,
+        _Out_ otai_status_t *object_statuses)
+{
+    MUTEX();
+    SWSS_LOG_ENTER();
+    REDIS_CHECK_API_INITIALIZED();
+
+    return m_context->m_meta->bulkCreate(
+            objectType,
+            linecardId,
+            object_count,
+            attr_count,
+            attr_list,
+            object_id,
+            object_statuses);
+}
+
+otai_status_t Otai::bulkRemove(
+        _In_ otai_object_type_t objectType,
+        _In_ uint32_t object_count,
+        _In_ const otai_object_id_t *object_id,
+        _Out_ otai_status_t *object_statuses)
+{
+    MUTEX();
+    SWSS_LOG_ENTER();
+    REDIS_CHECK_API_INITIALIZED();
+
+    return m_context->m_meta->bulkRemove(objectType, object_count, object_id, object_statuses);
+}
+
+otai_status_t Otai::bulkSet(
+        _In_ otai_object_type_t objectType,
+        _In_ uint32_t object_count,
+        _In_ const otai_object_id_t *object_id,
+        _In_ const otai_attribute_t *attr_list,
+        _Out_ otai_status_t *object_statuses)
+{
+    MUTEX();
+    SWSS_LOG_ENTER();
+    REDIS_CHECK_API_INITIALIZED();
+
+    return m_context->m_meta->bulkSet(objectType, object_count, object_id, attr_list, object_statuses);
+}
+
 // OTAI API
 
 // STATS
 
+// stats don't take api mutex, same as get, only context lock
+
 otai_status_t Otai::getStats(
         _In_ otai_object_type_t object_type,
         _In_ otai_object_id_t object_id,
@@ -184,7 +248,7 @@ otai_status_t Otai::getStats(
         _In_ const otai_stat_id_t *counter_ids,
         _Out_ otai_stat_value_t *counters)
 {
-    MUTEX();
+    CONTEXT_SHARED();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
@@ -204,7 +268,7 @@ otai_status_t Otai::getStatsExt(
         _In_ otai_stats_mode_t mode,
         _Out_ otai_stat_value_t *counters)
 {
-    MUTEX();
+    CONTEXT_SHARED();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
@@ -223,7 +287,7 @@ otai_status_t Otai::clearStats(
         _In_ uint32_t number_of_counters,
         _In_ const otai_stat_id_t *counter_ids)
 {
-    MUTEX();
+    CONTEXT_SHARED();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
@@ -11,6 +11,7 @@
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <map>
 
 namespace otairedis
@@ -58,6 +59,30 @@ namespace otairedis
                     _In_ uint32_t attr_count,
                     _Inout_ otai_attribute_t *attr_list) override;
 
+        public: // bulk QUAD oid
+
+            virtual otai_status_t bulkCreate(
+                    _In_ otai_object_type_t objectType,
+                    _In_ otai_object_id_t linecardId,
+                    _In_ uint32_t object_count,
+                    _In_ const uint32_t *attr_count,
+                    _In_ const otai_attribute_t **attr_list,
+                    _Out_ otai_object_id_t *object_id,
+                    _Out_ otai_status_t *object_statuses) override;
+
+            virtual otai_status_t bulkRemove(
+                    _In_ otai_object_type_t objectType,
+                    _In_ uint32_t object_count,
+                    _In_ const otai_object_id_t *object_id,
+                    _Out_ otai_status_t *object_statuses) override;
+
+            virtual otai_status_t bulkSet(
+                    _In_ otai_object_type_t objectType,
+                    _In_ uint32_t object_count,
+                    _In_ const otai_object_id_t *object_id,
+                    _In_ const otai_attribute_t *attr_list,
+                    _Out_ otai_status_t *object_statuses) override;
+
         public: // stats API
 
             virtual otai_status_t getStats(
@@ -107,6 +132,8 @@ namespace otairedis
 
             std::recursive_mutex m_apimutex;
 
+            std::shared_timed_mutex m_contextMutex;
+
             std::shared_ptr<Context> m_context;
 
             otai_service_method_table_t m_service_method_table;
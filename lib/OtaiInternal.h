@@ -2,3 +2,11 @@
 
 #define MUTEX() std::lock_guard<std::recursive_mutex> _lock(m_apimutex)
 #define MUTEX_UNLOCK() m_apimutex.unlock()
+
+/*
+ * Get and stats don't take api mutex, they hold context lock shared, while
+ * calls replacing context or channel (initialize, uninitialize, redis
+ * extension attributes) hold it exclusive, after api mutex.
+ */
+#define CONTEXT_SHARED() std::shared_lock<std::shared_timed_mutex> _contextLock(m_contextMutex)
+#define CONTEXT_EXCLUSIVE() std::unique_lock<std::shared_timed_mutex> _contextLock(m_contextMutex)
@@ -7,13 +7,30 @@
 #include "swss/logger.h"
 #include "swss/select.h"
 
+#include <inttypes.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+
+/*
+ * Spin before blocking on response only when responses recently came faster
+ * than threshold, spin at most twice the average response time.
+ */
+#define REDIS_CHANNEL_SPIN_THRESHOLD_US     500
+#define REDIS_CHANNEL_SPIN_MAX_US           500
+
 using namespace otairedis;
 
 RedisChannel::RedisChannel(
         _In_ const std::string& dbAsic,
         _In_ Channel::Callback callback):
     Channel(callback),
-    m_dbAsic(dbAsic)
+    m_dbAsic(dbAsic),
+    m_responseReader(false),
+    m_correlationId(0),
+    m_responseLatencyUs(REDIS_CHANNEL_SPIN_THRESHOLD_US)
 {
     SWSS_LOG_ENTER();
 
@@ -24,6 +41,8 @@ RedisChannel::RedisChannel(
     m_asicState             = std::make_shared<swss::ProducerTable>(m_redisPipeline.get(), ASIC_STATE_TABLE, true);
     m_getConsumer           = std::make_shared<swss::ConsumerTable>(m_db.get(), REDIS_TABLE_GETRESPONSE);
 
+    m_responseSelect.addSelectable(m_getConsumer.get());
+
     m_dbNtf                 = std::make_shared<swss::DBConnector>(dbAsic, 0);
     m_notificationConsumer  = std::make_shared<swss::NotificationConsumer>(m_dbNtf.get(), REDIS_TABLE_NOTIFICATIONS);
 
@@ -129,6 +148,8 @@ void RedisChannel::setBuffered(
 {
     SWSS_LOG_ENTER();
 
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+
     m_asicState->setBuffered(buffered);
 }
 
@@ -136,6 +157,8 @@ void RedisChannel::flush()
 {
     SWSS_LOG_ENTER();
 
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+
     m_asicState->flush();
 }
 
@@ -146,6 +169,8 @@ void RedisChannel::set(
 {
     SWSS_LOG_ENTER();
 
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+
     m_asicState->set(key, values, command);
 }
 
@@ -155,60 +180,176 @@ void RedisChannel::del(
 {
     SWSS_LOG_ENTER();
 
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+
     m_asicState->del(key, command);
 }
 
+uint64_t RedisChannel::request(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t correlationId;
+
+    {
+        std::lock_guard<std::mutex> lock(m_responseMutex);
+
+        correlationId = ++m_correlationId;
+
+        // register before sending, response may be read by other thread
+        // before this thread starts waiting
+
+        m_pendingRequests[correlationId] = std::chrono::steady_clock::now();
+    }
+
+    std::vector<swss::FieldValueTuple> entry = values;
+
+    entry.emplace_back(REDIS_ASIC_STATE_META_ID, std::to_string(correlationId));
+
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+
+    m_asicState->set(key, entry, command);
+
+    // in asynchronous mode pipeline is buffered, request must leave now
+
+    m_asicState->flush();
+
+    return correlationId;
+}
+
+void RedisChannel::dispatchResponse(
+        _In_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string &op = kfvOp(kco);
+    const std::string &opkey = kfvKey(kco);
+
+    SWSS_LOG_DEBUG("response: op = %s, key = %s", op.c_str(), opkey.c_str());
+
+    if (op != REDIS_ASIC_STATE_COMMAND_GETRESPONSE)
+    {
+        SWSS_LOG_WARN("got not expected response: %s:%s", opkey.c_str(), op.c_str());
+
+        // ignore non response messages
+        return;
+    }
+
+    auto& values = kfvFieldsValues(kco);
+
+    // response without valid correlation id can't be matched, handing it to
+    // any waiting request could deliver late response to unrelated request
+
+    if (values.empty() || fvField(values.back()) != REDIS_ASIC_STATE_META_ID)
+    {
+        SWSS_LOG_ERROR("dropping response %s without request id", opkey.c_str());
+
+        return;
+    }
+
+    const std::string& strCorrelationId = fvValue(values.back());
+
+    char* end = nullptr;
+
+    errno = 0;
+
+    uint64_t correlationId = strtoull(strCorrelationId.c_str(), &end, 10);
+
+    if (strCorrelationId.empty() || errno != 0 || *end != '\0')
+    {
+        SWSS_LOG_ERROR("dropping response %s with invalid request id '%s'",
+                opkey.c_str(),
+                strCorrelationId.c_str());
+
+        return;
+    }
+
+    values.pop_back();
+
+    auto it = m_pendingRequests.find(correlationId);
+
+    if (it == m_pendingRequests.end())
+    {
+        SWSS_LOG_WARN("dropping response %s to request %" PRIu64 " which is not waiting",
+                opkey.c_str(),
+                correlationId);
+
+        return;
+    }
+
+    uint64_t latencyUs = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - it->second).count();
+
+    m_responseLatencyUs = (7 * m_responseLatencyUs + latencyUs) / 8;
+
+    SWSS_LOG_DEBUG("request %" PRIu64 " response in %" PRIu64 " us, average %" PRIu64 " us",
+            correlationId,
+            latencyUs,
+            m_responseLatencyUs);
+
+    m_responses[correlationId] = std::move(kco);
+}
+
+int RedisChannel::selectResponse(
+        _In_ std::chrono::steady_clock::time_point deadline,
+        _In_ uint64_t spinUs)
+{
+    SWSS_LOG_ENTER();
+
+    swss::Selectable *sel;
+
+    auto spinEnd = std::chrono::steady_clock::now() + std::chrono::microseconds(spinUs);
+
+    while (std::chrono::steady_clock::now() < spinEnd)
+    {
+        int result = m_responseSelect.select(&sel, 0);
+
+        if (result != swss::Select::TIMEOUT)
+        {
+            return result;
+        }
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (now >= deadline)
+    {
+        return swss::Select::TIMEOUT;
+    }
+
+    // round up, so we don't busy loop on last millisecond
+
+    int timeout = (int)std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count() + 1;
+
+    return m_responseSelect.select(&sel, timeout);
+}
+
 otai_status_t RedisChannel::wait(
         _In_ const std::string& command,
+        _In_ uint64_t correlationId,
         _Out_ swss::KeyOpFieldsValuesTuple& kco)
 {
     SWSS_LOG_ENTER();
 
-    swss::Select s;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_responseTimeoutMs);
 
-    s.addSelectable(m_getConsumer.get());
+    std::unique_lock<std::mutex> lock(m_responseMutex);
 
     while (true)
     {
-        SWSS_LOG_DEBUG("wait for %s response", command.c_str());
-
-        swss::Selectable *sel;
+        auto it = m_responses.find(correlationId);
 
-        int result = s.select(&sel, (int)m_responseTimeoutMs);
-
-        if (result == swss::Select::OBJECT)
+        if (it != m_responses.end())
         {
-            std::deque<swss::KeyOpFieldsValuesTuple> vkco;
-
-            m_getConsumer->pops(vkco);
-
-            if (vkco.empty())
-            {
-                std::string &key = kfvKey(kco);
-                std::string &op = kfvOp(kco);
-                std::vector<swss::FieldValueTuple> &fvs = kfvFieldsValues(kco);
-
-                fvs.clear();
-                key.clear();
-                op.clear();
-            }
-            else
-            {
-                kco = vkco.back();
-            }
-
-            const std::string &op = kfvOp(kco);
-            const std::string &opkey = kfvKey(kco);
-
-            SWSS_LOG_DEBUG("response: op = %s, key = %s", opkey.c_str(), op.c_str());
+            kco = std::move(it->second);
 
-            if (op != command)
-            {
-                SWSS_LOG_WARN("got not expected response: %s:%s", opkey.c_str(), op.c_str());
+            m_responses.erase(it);
+            m_pendingRequests.erase(correlationId);
 
-                // ignore non response messages
-                continue;
-            }
+            const std::string &opkey = kfvKey(kco);
 
             otai_status_t status;
             otai_deserialize_status(opkey, status);
@@ -218,10 +359,68 @@ otai_status_t RedisChannel::wait(
             return status;
         }
 
-        SWSS_LOG_ERROR("SELECT operation result: %s on %s", getSelectResultAsString(result).c_str(), command.c_str());
-        break;
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            SWSS_LOG_ERROR("SELECT operation result: TIMEOUT on %s", command.c_str());
+            break;
+        }
+
+        if (m_responseReader)
+        {
+            // other thread reads responses, it will pass ours if it comes
+
+            m_responseCv.wait_until(lock, deadline);
+            continue;
+        }
+
+        m_responseReader = true;
+
+        uint64_t spinUs = 0;
+
+        if (m_responseLatencyUs < REDIS_CHANNEL_SPIN_THRESHOLD_US)
+        {
+            spinUs = std::min<uint64_t>(2 * m_responseLatencyUs, REDIS_CHANNEL_SPIN_MAX_US);
+        }
+
+        lock.unlock();
+
+        SWSS_LOG_DEBUG("wait for %s response", command.c_str());
+
+        int result = selectResponse(deadline, spinUs);
+
+        // pop single response, select doesn't look into consumer buffer,
+        // but each response is published with its own notification, and
+        // consumer keeps notification count, so responses left in buffer
+        // by pop are still reported by next selects
+
+        swss::KeyOpFieldsValuesTuple response;
+
+        if (result == swss::Select::OBJECT)
+        {
+            m_getConsumer->pop(response);
+        }
+
+        lock.lock();
+
+        m_responseReader = false;
+
+        if (result == swss::Select::OBJECT)
+        {
+            dispatchResponse(response);
+        }
+
+        m_responseCv.notify_all();
+
+        if (result != swss::Select::OBJECT && result != swss::Select::TIMEOUT)
+        {
+            SWSS_LOG_ERROR("SELECT operation result: %s on %s", getSelectResultAsString(result).c_str(), command.c_str());
+            break;
+        }
     }
 
+    m_pendingRequests.erase(correlationId);
+    m_responses.erase(correlationId);
+
     SWSS_LOG_ERROR("failed to get response for %s", command.c_str());
 
     return OTAI_STATUS_FAILURE;
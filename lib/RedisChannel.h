@@ -9,9 +9,15 @@
 #include "swss/consumertable.h"
 #include "swss/notificationconsumer.h"
 #include "swss/selectableevent.h"
+#include "swss/select.h"
 
 #include <memory>
 #include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <chrono>
 
 namespace otairedis
 {
@@ -44,14 +50,41 @@ namespace otairedis
                     _In_ const std::string& key,
                     _In_ const std::string& command) override;
 
+            virtual uint64_t request(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command) override;
+
             virtual otai_status_t wait(
                     _In_ const std::string& command,
+                    _In_ uint64_t correlationId,
                     _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
 
         protected:
 
             virtual void notificationThreadFunction() override;
 
+        private:
+
+            /**
+             * @brief Pass response to waiting request by correlation id.
+             *
+             * Must be called with response mutex held.
+             */
+            void dispatchResponse(
+                    _In_ swss::KeyOpFieldsValuesTuple& kco);
+
+            /**
+             * @brief Select on response queue.
+             *
+             * When responses recently arrived fast, poll queue for short
+             * time before blocking, to not pay for sleep and wakeup on sub
+             * millisecond vendor operations.
+             */
+            int selectResponse(
+                    _In_ std::chrono::steady_clock::time_point deadline,
+                    _In_ uint64_t spinUs);
+
         private:
 
             std::string m_dbAsic;
@@ -74,6 +107,46 @@ namespace otairedis
 
             std::shared_ptr<swss::RedisPipeline> m_redisPipeline;
 
+            /**
+             * @brief Guards asic state producer and pipeline, requests can
+             * be sent from multiple threads.
+             */
+            std::mutex m_sendMutex;
+
+        private: // response demultiplexer
+
+            std::mutex m_responseMutex;
+
+            std::condition_variable m_responseCv;
+
+            /**
+             * @brief Whether some waiting thread is reading responses, only
+             * one thread reads at a time, others wait on condition.
+             */
+            bool m_responseReader;
+
+            uint64_t m_correlationId;
+
+            /**
+             * @brief Requests waiting for response, responses to ids which
+             * already timed out are dropped.
+             */
+            std::map<uint64_t, std::chrono::steady_clock::time_point> m_pendingRequests;
+
+            std::map<uint64_t, swss::KeyOpFieldsValuesTuple> m_responses;
+
+            /**
+             * @brief Selector on response queue, used only by thread which
+             * is currently reading responses.
+             */
+            swss::Select m_responseSelect;
+
+            /**
+             * @brief Moving average of request to response time, decides
+             * whether waiting thread should spin before blocking.
+             */
+            uint64_t m_responseLatencyUs;
+
         private: // notification
 
             /**
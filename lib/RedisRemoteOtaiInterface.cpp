@@ -8,15 +8,14 @@
 #include "meta/otai_serialize.h"
 #include "meta/OtaiAttributeList.h"
 
+#include "swss/json.h"
+
 #include <inttypes.h>
 
 using namespace otairedis;
 using namespace otaimeta;
 using namespace std::placeholders;
 
-std::string joinFieldValues(
-        _In_ const std::vector<swss::FieldValueTuple> &values);
-
 std::vector<swss::FieldValueTuple> serialize_counter_id_list(
         _In_ const otai_enum_metadata_t *stats_enum,
         _In_ uint32_t count,
@@ -35,6 +34,14 @@ RedisRemoteOtaiInterface::RedisRemoteOtaiInterface(
 
     m_initialized = false;
 
+    m_asyncMode = false;
+
+    m_asyncFailureNotify = nullptr;
+
+    m_traceThresholdUs = 0;
+
+    m_staticAttributeCacheEnabled = false;
+
     initialize(0, nullptr);
 }
 
@@ -158,6 +165,14 @@ otai_status_t RedisRemoteOtaiInterface::create(
             attr_count,
             attr_list);
 
+    // asynchronous create is not confirmed yet, don't cache values of
+    // object which may not exist
+
+    if (m_staticAttributeCacheEnabled && status == OTAI_STATUS_SUCCESS && !isAsync(objectType))
+    {
+        m_staticAttributeCache.update(objectType, *objectId, attr_count, attr_list);
+    }
+
     if (objectType == OTAI_OBJECT_TYPE_LINECARD && status == OTAI_STATUS_SUCCESS)
     {
         /*
@@ -180,6 +195,8 @@ otai_status_t RedisRemoteOtaiInterface::remove(
 {
     SWSS_LOG_ENTER();
 
+    m_staticAttributeCache.remove(objectId);
+
     auto status = remove(
             objectType,
             otai_serialize_object_id(objectId));
@@ -219,7 +236,61 @@ otai_status_t RedisRemoteOtaiInterface::setRedisExtensionAttribute(
             m_communicationChannel->flush();
 
             return OTAI_STATUS_SUCCESS;
-            
+
+        case OTAI_REDIS_LINECARD_ATTR_ASYNC_MODE:
+
+            if (!attr->value.booldata)
+            {
+                // send everything buffered so far before going back to
+                // synchronous mode
+
+                m_communicationChannel->flush();
+            }
+
+            m_asyncMode = attr->value.booldata;
+
+            m_communicationChannel->setBuffered(m_asyncMode);
+
+            SWSS_LOG_NOTICE("async mode %s", m_asyncMode ? "enabled" : "disabled");
+
+            return OTAI_STATUS_SUCCESS;
+
+        case OTAI_REDIS_LINECARD_ATTR_ASYNC_FAILURE_NOTIFY:
+
+            m_asyncFailureNotify = (otai_redis_async_failure_notification_fn)attr->value.ptr;
+
+            return OTAI_STATUS_SUCCESS;
+
+        case OTAI_REDIS_LINECARD_ATTR_TRACE_THRESHOLD:
+
+            m_traceThresholdUs = attr->value.u32;
+
+            SWSS_LOG_NOTICE("request trace threshold %u us", attr->value.u32);
+
+            return OTAI_STATUS_SUCCESS;
+
+        case OTAI_REDIS_LINECARD_ATTR_STATIC_ATTR_CACHE:
+
+            m_staticAttributeCacheEnabled = attr->value.booldata;
+
+            if (!attr->value.booldata)
+            {
+                m_staticAttributeCache.clear();
+            }
+
+            SWSS_LOG_NOTICE("static attribute cache %s", attr->value.booldata ? "enabled" : "disabled");
+
+            return OTAI_STATUS_SUCCESS;
+
+        case OTAI_REDIS_LINECARD_ATTR_TRACE_DUMP:
+
+            if (attr->value.booldata)
+            {
+                dumpSlowRequests();
+            }
+
+            return OTAI_STATUS_SUCCESS;
+
         default:
             break;
     }
@@ -241,6 +312,11 @@ otai_status_t RedisRemoteOtaiInterface::set(
         return setRedisExtensionAttribute(objectType, objectId, attr);
     }
 
+    if (attr)
+    {
+        m_staticAttributeCache.invalidate(objectId, attr->id);
+    }
+
     auto status = set(
             objectType,
             otai_serialize_object_id(objectId),
@@ -269,11 +345,28 @@ otai_status_t RedisRemoteOtaiInterface::get(
 {
     SWSS_LOG_ENTER();
 
-    return get(
+    if (m_staticAttributeCacheEnabled && m_staticAttributeCache.tryGet(objectType, objectId, attr_count, attr_list))
+    {
+        return OTAI_STATUS_SUCCESS;
+    }
+
+    // get is not serialized with remove, generation tells if object was
+    // removed while request was in flight
+
+    uint64_t generation = m_staticAttributeCache.getGeneration();
+
+    auto status = get(
             objectType,
             otai_serialize_object_id(objectId),
             attr_count,
             attr_list);
+
+    if (m_staticAttributeCacheEnabled && status == OTAI_STATUS_SUCCESS)
+    {
+        m_staticAttributeCache.update(objectType, objectId, generation, attr_count, attr_list);
+    }
+
+    return status;
 }
 
 otai_status_t RedisRemoteOtaiInterface::create(
@@ -305,9 +398,18 @@ otai_status_t RedisRemoteOtaiInterface::create(
 
     SWSS_LOG_NOTICE("generic create key: %s, fields: %zu", key.c_str(), entry.size());
 
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_CREATE);
+    if (isAsync(object_type))
+    {
+        addAsyncMeta(entry);
+
+        m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_CREATE);
+
+        return OTAI_STATUS_SUCCESS;
+    }
+
+    auto requestId = sendRequest(key, entry, REDIS_ASIC_STATE_COMMAND_CREATE);
 
-    auto status = waitForResponse(OTAI_COMMON_API_CREATE);
+    auto status = waitForResponse(OTAI_COMMON_API_CREATE, requestId);
     SWSS_LOG_NOTICE("generic create key end: %s, fields: %zu", key.c_str(), entry.size());
 
     return status;
@@ -325,9 +427,24 @@ otai_status_t RedisRemoteOtaiInterface::remove(
 
     SWSS_LOG_NOTICE("generic remove key: %s", key.c_str());
 
-    m_communicationChannel->del(key, REDIS_ASIC_STATE_COMMAND_REMOVE);
+    if (isAsync(objectType))
+    {
+        // remove carries no attributes, metadata is sent as values
+
+        std::vector<swss::FieldValueTuple> entry;
+
+        addAsyncMeta(entry);
+
+        m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_REMOVE);
+
+        return OTAI_STATUS_SUCCESS;
+    }
+
+    // remove carries no attributes, only request metadata
 
-    auto status = waitForResponse(OTAI_COMMON_API_REMOVE);
+    auto requestId = sendRequest(key, {}, REDIS_ASIC_STATE_COMMAND_REMOVE);
+
+    auto status = waitForResponse(OTAI_COMMON_API_REMOVE, requestId);
 
     return status;
 }
@@ -351,28 +468,362 @@ otai_status_t RedisRemoteOtaiInterface::set(
 
     SWSS_LOG_DEBUG("generic set key: %s, fields: %zu", key.c_str(), entry.size());
 
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_SET);
+    if (isAsync(objectType))
+    {
+        addAsyncMeta(entry);
+
+        m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_SET);
+
+        return OTAI_STATUS_SUCCESS;
+    }
 
-    auto status = waitForResponse(OTAI_COMMON_API_SET);
+    auto requestId = sendRequest(key, entry, REDIS_ASIC_STATE_COMMAND_SET);
+
+    auto status = waitForResponse(OTAI_COMMON_API_SET, requestId);
 
     return status;
 }
 
-otai_status_t RedisRemoteOtaiInterface::waitForResponse(
-        _In_ otai_common_api_t api)
+otai_status_t RedisRemoteOtaiInterface::bulkCreate(
+        _In_ otai_object_type_t objectType,
+        _In_ otai_object_id_t linecardId,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const otai_attribute_t **attr_list,
+        _Out_ otai_object_id_t *object_id,
+        _Out_ otai_status_t *object_statuses)
 {
     SWSS_LOG_ENTER();
 
+    if (objectType == OTAI_OBJECT_TYPE_LINECARD)
+    {
+        SWSS_LOG_ERROR("linecard can't be created in bulk");
+
+        return OTAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        object_id[idx] = m_virtualObjectIdManager->allocateNewObjectId(objectType, linecardId);
+
+        if (object_id[idx] == OTAI_NULL_OBJECT_ID)
+        {
+            SWSS_LOG_ERROR("failed to create %s, with linecard id: %s",
+                    otai_serialize_object_type(objectType).c_str(),
+                    otai_serialize_object_id(linecardId).c_str());
+
+            for (uint32_t i = 0; i < object_count; i++)
+            {
+                object_id[i] = OTAI_NULL_OBJECT_ID;
+                object_statuses[i] = OTAI_STATUS_INSUFFICIENT_RESOURCES;
+            }
+
+            return OTAI_STATUS_INSUFFICIENT_RESOURCES;
+        }
+
+        auto entry = OtaiAttributeList::serialize_attr_list(
+                objectType,
+                attr_count[idx],
+                attr_list[idx],
+                false);
+
+        if (entry.empty())
+        {
+            // make sure that we put object into db
+            // even if there are no attributes set
+            swss::FieldValueTuple null("NULL", "NULL");
+
+            entry.push_back(null);
+        }
+
+        entries.emplace_back(otai_serialize_object_id(object_id[idx]), swss::JSon::buildJson(entry));
+    }
+
+    const std::string key = otai_serialize_object_type(objectType) + ":" + std::to_string(object_count);
+
+    SWSS_LOG_NOTICE("bulk create key: %s", key.c_str());
+
+    auto requestId = sendRequest(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_CREATE);
+
+    auto status = waitForBulkResponse(OTAI_COMMON_API_CREATE, requestId, object_count, object_statuses);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        if (object_statuses[idx] != OTAI_STATUS_SUCCESS)
+        {
+            object_id[idx] = OTAI_NULL_OBJECT_ID;
+        }
+    }
+
+    return status;
+}
+
+otai_status_t RedisRemoteOtaiInterface::bulkRemove(
+        _In_ otai_object_type_t objectType,
+        _In_ uint32_t object_count,
+        _In_ const otai_object_id_t *object_id,
+        _Out_ otai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (objectType == OTAI_OBJECT_TYPE_LINECARD)
+    {
+        SWSS_LOG_ERROR("linecard can't be removed in bulk");
+
+        return OTAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        m_staticAttributeCache.remove(object_id[idx]);
+
+        entries.emplace_back(otai_serialize_object_id(object_id[idx]), "");
+    }
+
+    const std::string key = otai_serialize_object_type(objectType) + ":" + std::to_string(object_count);
+
+    SWSS_LOG_NOTICE("bulk remove key: %s", key.c_str());
+
+    auto requestId = sendRequest(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_REMOVE);
+
+    return waitForBulkResponse(OTAI_COMMON_API_REMOVE, requestId, object_count, object_statuses);
+}
+
+otai_status_t RedisRemoteOtaiInterface::bulkSet(
+        _In_ otai_object_type_t objectType,
+        _In_ uint32_t object_count,
+        _In_ const otai_object_id_t *object_id,
+        _In_ const otai_attribute_t *attr_list,
+        _Out_ otai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (objectType == OTAI_OBJECT_TYPE_LINECARD)
+    {
+        SWSS_LOG_ERROR("linecard attributes can't be set in bulk");
+
+        return OTAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        m_staticAttributeCache.invalidate(object_id[idx], attr_list[idx].id);
+
+        auto entry = OtaiAttributeList::serialize_attr_list(
+                objectType,
+                1,
+                &attr_list[idx],
+                false);
+
+        entries.emplace_back(otai_serialize_object_id(object_id[idx]), swss::JSon::buildJson(entry));
+    }
+
+    const std::string key = otai_serialize_object_type(objectType) + ":" + std::to_string(object_count);
+
+    SWSS_LOG_DEBUG("bulk set key: %s", key.c_str());
+
+    auto requestId = sendRequest(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_SET);
+
+    return waitForBulkResponse(OTAI_COMMON_API_SET, requestId, object_count, object_statuses);
+}
+
+bool RedisRemoteOtaiInterface::isAsync(
+        _In_ otai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_asyncMode && objectType != OTAI_OBJECT_TYPE_LINECARD;
+}
+
+void RedisRemoteOtaiInterface::addAsyncMeta(
+        _Inout_ std::vector<swss::FieldValueTuple>& entry) const
+{
+    SWSS_LOG_ENTER();
+
+    entry.emplace_back(REDIS_ASIC_STATE_META_ASYNC, "true");
+}
+
+uint64_t RedisRemoteOtaiInterface::sendRequest(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_traceThresholdUs == 0)
+    {
+        return m_communicationChannel->request(key, values, command);
+    }
+
+    RequestTrace trace;
+
+    trace.mark(RequestTrace::STAGE_CLIENT_SEND);
+
+    std::vector<swss::FieldValueTuple> entry = values;
+
+    entry.emplace_back(REDIS_ASIC_STATE_META_TRACE, trace.serialize());
+
+    auto requestId = m_communicationChannel->request(key, entry, command);
+
+    std::lock_guard<std::mutex> lock(m_traceMutex);
+
+    m_tracedRequests[requestId] = command + " " + key;
+
+    return requestId;
+}
+
+otai_status_t RedisRemoteOtaiInterface::waitForRequestResponse(
+        _In_ uint64_t requestId,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, requestId, kco);
+
+    uint64_t receiveTime = RequestTrace::now();
+
+    auto& values = kfvFieldsValues(kco);
+
+    std::string strTrace;
+
+    if (values.size() && fvField(values.back()) == REDIS_ASIC_STATE_META_TRACE)
+    {
+        strTrace = fvValue(values.back());
+
+        values.pop_back();
+    }
+
+    std::string request;
+
+    {
+        std::lock_guard<std::mutex> lock(m_traceMutex);
+
+        auto it = m_tracedRequests.find(requestId);
+
+        if (it == m_tracedRequests.end())
+        {
+            return status;
+        }
+
+        request = it->second;
+
+        m_tracedRequests.erase(it);
+    }
+
+    RequestTrace trace;
+
+    if (strTrace.empty() || !trace.deserialize(strTrace))
+    {
+        // timeout, or syncd which doesn't support tracing
+
+        return status;
+    }
+
+    trace.mark(RequestTrace::STAGE_CLIENT_RECEIVE, receiveTime);
+
+    if (trace.getTotalUs() < m_traceThresholdUs)
+    {
+        return status;
+    }
+
+    auto record = request + ": " + trace.getBreakdown();
+
+    SWSS_LOG_NOTICE("slow request %s", record.c_str());
+
+    std::lock_guard<std::mutex> lock(m_traceMutex);
+
+    m_slowRequests.push_back(record);
+
+    if (m_slowRequests.size() > REDIS_REMOTE_TRACE_RING_SIZE)
+    {
+        m_slowRequests.pop_front();
+    }
+
+    return status;
+}
+
+void RedisRemoteOtaiInterface::dumpSlowRequests()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_traceMutex);
+
+    SWSS_LOG_NOTICE("%zu recent slow requests", m_slowRequests.size());
+
+    for (auto& record: m_slowRequests)
+    {
+        SWSS_LOG_NOTICE("slow request %s", record.c_str());
+    }
+
+    m_slowRequests.clear();
+}
+
+otai_status_t RedisRemoteOtaiInterface::waitForResponse(
+        _In_ otai_common_api_t api,
+        _In_ uint64_t requestId)
+{
+    SWSS_LOG_ENTER();
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = waitForRequestResponse(requestId, kco);
 
     return status;
+}
+
+otai_status_t RedisRemoteOtaiInterface::waitForBulkResponse(
+        _In_ otai_common_api_t api,
+        _In_ uint64_t requestId,
+        _In_ uint32_t object_count,
+        _Out_ otai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = waitForRequestResponse(requestId, kco);
+
+    auto &values = kfvFieldsValues(kco);
 
+    if (values.size() != object_count)
+    {
+        // timeout or syncd failed before processing objects
+
+        SWSS_LOG_ERROR("bulk %s response has %zu statuses, expected %u, status: %s",
+                otai_serialize_common_api(api).c_str(),
+                values.size(),
+                object_count,
+                otai_serialize_status(status).c_str());
+
+        if (status == OTAI_STATUS_SUCCESS)
+        {
+            status = OTAI_STATUS_FAILURE;
+        }
+
+        for (uint32_t idx = 0; idx < object_count; idx++)
+        {
+            object_statuses[idx] = status;
+        }
+
+        return status;
+    }
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        otai_deserialize_status(fvField(values[idx]), object_statuses[idx]);
+    }
+
+    return status;
 }
 
 otai_status_t RedisRemoteOtaiInterface::waitForGetResponse(
+        _In_ uint64_t requestId,
         _In_ otai_object_type_t objectType,
         _In_ uint32_t attr_count,
         _Inout_ otai_attribute_t *attr_list)
@@ -381,7 +832,7 @@ otai_status_t RedisRemoteOtaiInterface::waitForGetResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = waitForRequestResponse(requestId, kco);
 
     auto &values = kfvFieldsValues(kco);
 
@@ -438,9 +889,9 @@ otai_status_t RedisRemoteOtaiInterface::get(
 
     // get is special, it will not put data
     // into asic view, only to message queue
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET);
+    auto requestId = sendRequest(key, entry, REDIS_ASIC_STATE_COMMAND_GET);
 
-    auto status = waitForGetResponse(objectType, attr_count, attr_list);
+    auto status = waitForGetResponse(requestId, objectType, attr_count, attr_list);
 
     return status;
 }
@@ -467,12 +918,13 @@ otai_status_t RedisRemoteOtaiInterface::getStats(
 
     // get_stats will not put data to asic view, only to message queue
 
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET_STATS);
+    auto requestId = sendRequest(key, entry, REDIS_ASIC_STATE_COMMAND_GET_STATS);
 
-    return waitForGetStatsResponse(object_type, number_of_counters, counter_ids, counters);
+    return waitForGetStatsResponse(requestId, object_type, number_of_counters, counter_ids, counters);
 }
 
 otai_status_t RedisRemoteOtaiInterface::waitForGetStatsResponse(
+        _In_ uint64_t requestId,
         _In_ otai_object_type_t object_type,
         _In_ uint32_t number_of_counters,
         _In_ const otai_stat_id_t *counter_ids,
@@ -482,7 +934,7 @@ otai_status_t RedisRemoteOtaiInterface::waitForGetStatsResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = waitForRequestResponse(requestId, kco);
 
     if (status == OTAI_STATUS_SUCCESS)
     {
@@ -543,20 +995,21 @@ otai_status_t RedisRemoteOtaiInterface::clearStats(
     SWSS_LOG_DEBUG("generic clear stats key: %s, fields: %zu", key.c_str(), values.size());
 
     // clear_stats will not put data into asic view, only to message queue
-    m_communicationChannel->set(key, values, REDIS_ASIC_STATE_COMMAND_CLEAR_STATS);
+    auto requestId = sendRequest(key, values, REDIS_ASIC_STATE_COMMAND_CLEAR_STATS);
 
-    auto status = waitForClearStatsResponse();
+    auto status = waitForClearStatsResponse(requestId);
 
     return status;
 }
 
-otai_status_t RedisRemoteOtaiInterface::waitForClearStatsResponse()
+otai_status_t RedisRemoteOtaiInterface::waitForClearStatsResponse(
+        _In_ uint64_t requestId)
 {
     SWSS_LOG_ENTER();
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = waitForRequestResponse(requestId, kco);
 
     return status;
 }
@@ -596,6 +1049,43 @@ void RedisRemoteOtaiInterface::handleNotification(
     //
     // But before that we will extract linecard id from notification itself.
 
+    if (name == OTAI_REDIS_NOTIFICATION_NAME_ASYNC_FAILURE)
+    {
+        otai_status_t status = OTAI_STATUS_FAILURE;
+
+        std::string op;
+
+        for (auto& fv: values)
+        {
+            if (fvField(fv) == "status")
+                otai_deserialize_status(fvValue(fv), status);
+            else if (fvField(fv) == "op")
+                op = fvValue(fv);
+        }
+
+        SWSS_LOG_ERROR("async %s %s failed: %s",
+                op.c_str(),
+                serializedNotification.c_str(),
+                otai_serialize_status(status).c_str());
+
+        auto callback = m_asyncFailureNotify;
+
+        if (callback)
+        {
+            callback(serializedNotification.c_str(), op.c_str(), status);
+        }
+
+        return;
+    }
+
+    if (name == OTAI_LINECARD_NOTIFICATION_NAME_LINECARD_STATE_CHANGE)
+    {
+        // linecard could be replaced or upgraded, static values must be
+        // learned again
+
+        m_staticAttributeCache.clear();
+    }
+
     auto notification = NotificationFactory::deserialize(name, serializedNotification);
 
     if (notification)
@@ -643,6 +1133,8 @@ void RedisRemoteOtaiInterface::clear_local_state()
 
     m_linecard = nullptr;
 
+    m_staticAttributeCache.clear();
+
     m_virtualObjectIdManager = 
         std::make_shared<VirtualObjectIdManager>(
                 m_redisVidIndexGenerator);
@@ -4,6 +4,10 @@
 #include "VirtualObjectIdManager.h"
 #include "RedisVidIndexGenerator.h"
 #include "RedisChannel.h"
+#include "RequestTrace.h"
+#include "StaticAttributeCache.h"
+
+#include "otairedis.h"
 
 #include "meta/Notification.h"
 #include "meta/OtaiInterface.h"
@@ -13,10 +17,18 @@
 #include "swss/notificationconsumer.h"
 #include "swss/selectableevent.h"
 
+#include <atomic>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <functional>
 #include <map>
 
+/*
+ * Number of recent slow request traces kept in memory.
+ */
+#define REDIS_REMOTE_TRACE_RING_SIZE (64)
+
 namespace otairedis
 {
     class RedisRemoteOtaiInterface:
@@ -63,6 +75,30 @@ namespace otairedis
                     _In_ uint32_t attr_count,
                     _Inout_ otai_attribute_t *attr_list) override;
 
+        public: // bulk QUAD oid
+
+            virtual otai_status_t bulkCreate(
+                    _In_ otai_object_type_t objectType,
+                    _In_ otai_object_id_t linecardId,
+                    _In_ uint32_t object_count,
+                    _In_ const uint32_t *attr_count,
+                    _In_ const otai_attribute_t **attr_list,
+                    _Out_ otai_object_id_t *object_id,
+                    _Out_ otai_status_t *object_statuses) override;
+
+            virtual otai_status_t bulkRemove(
+                    _In_ otai_object_type_t objectType,
+                    _In_ uint32_t object_count,
+                    _In_ const otai_object_id_t *object_id,
+                    _Out_ otai_status_t *object_statuses) override;
+
+            virtual otai_status_t bulkSet(
+                    _In_ otai_object_type_t objectType,
+                    _In_ uint32_t object_count,
+                    _In_ const otai_object_id_t *object_id,
+                    _In_ const otai_attribute_t *attr_list,
+                    _Out_ otai_status_t *object_statuses) override;
+
         public: // stats API
 
             virtual otai_status_t getStats(
@@ -139,6 +175,38 @@ namespace otairedis
 
         private: // QUAD API response
 
+            /**
+             * @brief Whether create/remove/set on object type should be sent
+             * without waiting for response.
+             */
+            bool isAsync(
+                    _In_ otai_object_type_t objectType) const;
+
+            /**
+             * @brief Append request metadata for asynchronous request.
+             */
+            void addAsyncMeta(
+                    _Inout_ std::vector<swss::FieldValueTuple>& entry) const;
+
+            /**
+             * @brief Send request which waits for response, trace metadata
+             * is added when tracing is enabled.
+             */
+            uint64_t sendRequest(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command);
+
+            /**
+             * @brief Wait for response to request and strip trace metadata
+             * from it, slow request is logged and put to trace ring.
+             */
+            otai_status_t waitForRequestResponse(
+                    _In_ uint64_t requestId,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco);
+
+            void dumpSlowRequests();
+
             /**
              * @brief Wait for response.
              *
@@ -147,7 +215,8 @@ namespace otairedis
              * otai_status_t.
              */
             otai_status_t waitForResponse(
-                    _In_ otai_common_api_t api);
+                    _In_ otai_common_api_t api,
+                    _In_ uint64_t requestId);
 
             /**
              * @brief Wait for GET response.
@@ -160,19 +229,35 @@ namespace otairedis
              * list at all.
              */
             otai_status_t waitForGetResponse(
+                    _In_ uint64_t requestId,
                     _In_ otai_object_type_t objectType,
                     _In_ uint32_t attr_count,
                     _Inout_ otai_attribute_t *attr_list);
 
+            /**
+             * @brief Wait for bulk response.
+             *
+             * Will wait for response from syncd. Response contains overall
+             * status and status of each object in the same order as objects
+             * were sent.
+             */
+            otai_status_t waitForBulkResponse(
+                    _In_ otai_common_api_t api,
+                    _In_ uint64_t requestId,
+                    _In_ uint32_t object_count,
+                    _Out_ otai_status_t *object_statuses);
+
         private: // stats API response
 
             otai_status_t waitForGetStatsResponse(
+                    _In_ uint64_t requestId,
                     _In_ otai_object_type_t object_type,
                     _In_ uint32_t number_of_counters,
                     _In_ const otai_stat_id_t *counter_ids,
                     _Out_ otai_stat_value_t *counters);
 
-            otai_status_t waitForClearStatsResponse();
+            otai_status_t waitForClearStatsResponse(
+                    _In_ uint64_t requestId);
 
         private: // notification
             void handleNotification(
@@ -209,5 +294,33 @@ namespace otairedis
 
             std::function<otai_linecard_notifications_t(std::shared_ptr<Notification>)> m_notificationCallback;
 
+            /**
+             * @brief Asynchronous mode, create/remove/set don't wait for
+             * syncd response.
+             */
+            bool m_asyncMode;
+
+            otai_redis_async_failure_notification_fn m_asyncFailureNotify;
+
+            /**
+             * @brief Request trace threshold, zero when tracing is disabled.
+             *
+             * Get is not serialized by api mutex, so trace state is guarded
+             * by separate mutex.
+             */
+            std::atomic<uint32_t> m_traceThresholdUs;
+
+            std::mutex m_traceMutex;
+
+            /**
+             * @brief Traced requests in flight, request id to command and key.
+             */
+            std::map<uint64_t, std::string> m_tracedRequests;
+
+            std::deque<std::string> m_slowRequests;
+
+            std::atomic<bool> m_staticAttributeCacheEnabled;
+
+            StaticAttributeCache m_staticAttributeCache;
     };
 }
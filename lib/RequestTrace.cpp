@@ -0,0 +1,148 @@
+#include "RequestTrace.h"
+
+#include "swss/logger.h"
+#include "swss/tokenize.h"
+
+#include <chrono>
+#include <sstream>
+
+using namespace otairedis;
+
+RequestTrace::RequestTrace()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& time: m_times)
+    {
+        time = 0;
+    }
+}
+
+uint64_t RequestTrace::now()
+{
+    SWSS_LOG_ENTER();
+
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void RequestTrace::mark(
+        _In_ stage_t stage,
+        _In_ uint64_t time)
+{
+    SWSS_LOG_ENTER();
+
+    if (stage < STAGE_MAX)
+    {
+        m_times[stage] = time;
+    }
+}
+
+void RequestTrace::mark(
+        _In_ stage_t stage)
+{
+    SWSS_LOG_ENTER();
+
+    mark(stage, now());
+}
+
+uint64_t RequestTrace::getTime(
+        _In_ stage_t stage) const
+{
+    SWSS_LOG_ENTER();
+
+    return (stage < STAGE_MAX) ? m_times[stage] : 0;
+}
+
+uint64_t RequestTrace::getDurationUs(
+        _In_ stage_t from,
+        _In_ stage_t to) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_times[from] == 0 || m_times[to] < m_times[from])
+    {
+        return 0;
+    }
+
+    return m_times[to] - m_times[from];
+}
+
+uint64_t RequestTrace::getTotalUs() const
+{
+    SWSS_LOG_ENTER();
+
+    return getDurationUs(STAGE_CLIENT_SEND, STAGE_CLIENT_RECEIVE);
+}
+
+std::string RequestTrace::serialize() const
+{
+    SWSS_LOG_ENTER();
+
+    std::string data;
+
+    for (int stage = 0; stage < STAGE_MAX; stage++)
+    {
+        if (stage)
+        {
+            data += ":";
+        }
+
+        data += std::to_string(m_times[stage]);
+    }
+
+    return data;
+}
+
+bool RequestTrace::deserialize(
+        _In_ const std::string& data)
+{
+    SWSS_LOG_ENTER();
+
+    auto tokens = swss::tokenize(data, ':');
+
+    if (tokens.empty() || tokens.size() > STAGE_MAX)
+    {
+        SWSS_LOG_ERROR("invalid request trace: %s", data.c_str());
+
+        return false;
+    }
+
+    for (int stage = 0; stage < STAGE_MAX; stage++)
+    {
+        m_times[stage] = 0;
+    }
+
+    try
+    {
+        for (size_t idx = 0; idx < tokens.size(); idx++)
+        {
+            m_times[idx] = std::stoull(tokens[idx]);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("invalid request trace %s: %s", data.c_str(), e.what());
+
+        return false;
+    }
+
+    return true;
+}
+
+std::string RequestTrace::getBreakdown() const
+{
+    SWSS_LOG_ENTER();
+
+    std::stringstream ss;
+
+    ss << "total " << getTotalUs() << " us"
+        << ", queue " << getDurationUs(STAGE_CLIENT_SEND, STAGE_SYNCD_RECEIVE) << " us"
+        << " (lock " << getDurationUs(STAGE_SYNCD_LOCK_REQUEST, STAGE_SYNCD_LOCK_ACQUIRED) << " us)"
+        << ", syncd " << getDurationUs(STAGE_SYNCD_RECEIVE, STAGE_VENDOR_START) << " us"
+        << ", vendor " << getDurationUs(STAGE_VENDOR_START, STAGE_VENDOR_END) << " us"
+        << ", post " << getDurationUs(STAGE_VENDOR_END, STAGE_SYNCD_RESPONSE) << " us"
+        << ", return " << getDurationUs(STAGE_SYNCD_RESPONSE, STAGE_CLIENT_RECEIVE) << " us";
+
+    return ss.str();
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <cstdint>
+#include <string>
+
+namespace otairedis
+{
+    /**
+     * @brief Timestamps of request on its way from otairedis to syncd and
+     * back.
+     *
+     * Trace is carried in REDIS_META_TRACE field of request and response as
+     * ':' separated list of steady clock microseconds. Steady clock is
+     * CLOCK_MONOTONIC, which is shared by processes on same host. Stages
+     * which request didn't pass are zero.
+     */
+    class RequestTrace
+    {
+        public:
+
+            typedef enum _stage_t
+            {
+                STAGE_CLIENT_SEND,
+
+                STAGE_SYNCD_LOCK_REQUEST,
+
+                STAGE_SYNCD_LOCK_ACQUIRED,
+
+                STAGE_SYNCD_RECEIVE,
+
+                STAGE_VENDOR_START,
+
+                STAGE_VENDOR_END,
+
+                STAGE_SYNCD_RESPONSE,
+
+                STAGE_CLIENT_RECEIVE,
+
+                STAGE_MAX,
+
+            } stage_t;
+
+        public:
+
+            RequestTrace();
+
+            virtual ~RequestTrace() = default;
+
+        public:
+
+            static uint64_t now();
+
+            void mark(
+                    _In_ stage_t stage,
+                    _In_ uint64_t time);
+
+            void mark(
+                    _In_ stage_t stage);
+
+            uint64_t getTime(
+                    _In_ stage_t stage) const;
+
+            /**
+             * @brief Time from client send to client receive.
+             */
+            uint64_t getTotalUs() const;
+
+            std::string serialize() const;
+
+            /**
+             * @brief Deserialize trace, stages missing in input are zero.
+             *
+             * @return False when input is not valid trace.
+             */
+            bool deserialize(
+                    _In_ const std::string& data);
+
+            /**
+             * @brief Human readable breakdown: time in redis queue (of which
+             * waiting on syncd lock), in syncd before and after vendor call,
+             * in vendor, and on way back.
+             */
+            std::string getBreakdown() const;
+
+        private:
+
+            uint64_t getDurationUs(
+                    _In_ stage_t from,
+                    _In_ stage_t to) const;
+
+        private:
+
+            uint64_t m_times[STAGE_MAX];
+    };
+}
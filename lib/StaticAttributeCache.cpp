@@ -0,0 +1,204 @@
+#include "StaticAttributeCache.h"
+
+#include "meta/otai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <vector>
+
+using namespace otairedis;
+
+StaticAttributeCache::StaticAttributeCache():
+    m_generation(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+bool StaticAttributeCache::isStatic(
+        _In_ const otai_attr_metadata_t* md)
+{
+    SWSS_LOG_ENTER();
+
+    if (md == NULL)
+    {
+        return false;
+    }
+
+    switch (md->attrvaluetype)
+    {
+        case OTAI_ATTR_VALUE_TYPE_BOOL:
+        case OTAI_ATTR_VALUE_TYPE_UINT8:
+        case OTAI_ATTR_VALUE_TYPE_INT8:
+        case OTAI_ATTR_VALUE_TYPE_UINT16:
+        case OTAI_ATTR_VALUE_TYPE_INT16:
+        case OTAI_ATTR_VALUE_TYPE_UINT32:
+        case OTAI_ATTR_VALUE_TYPE_INT32:
+        case OTAI_ATTR_VALUE_TYPE_UINT64:
+        case OTAI_ATTR_VALUE_TYPE_INT64:
+        case OTAI_ATTR_VALUE_TYPE_DOUBLE:
+        case OTAI_ATTR_VALUE_TYPE_CHARDATA:
+        case OTAI_ATTR_VALUE_TYPE_OBJECT_ID:
+        case OTAI_ATTR_VALUE_TYPE_UINT32_RANGE:
+        case OTAI_ATTR_VALUE_TYPE_INT32_RANGE:
+            break;
+
+        default:
+            return false;
+    }
+
+    // read only values, even inventory like serial number, belong often to
+    // pluggable modules and change on hot swap or firmware upgrade
+
+    return OTAI_HAS_FLAG_CREATE_ONLY(md->flags);
+}
+
+uint64_t StaticAttributeCache::getGeneration()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_generation;
+}
+
+void StaticAttributeCache::update(
+        _In_ otai_object_type_t objectType,
+        _In_ otai_object_id_t objectId,
+        _In_ uint32_t attr_count,
+        _In_ const otai_attribute_t* attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    update(objectType, objectId, getGeneration(), attr_count, attr_list);
+}
+
+void StaticAttributeCache::update(
+        _In_ otai_object_type_t objectType,
+        _In_ otai_object_id_t objectId,
+        _In_ uint64_t generation,
+        _In_ uint32_t attr_count,
+        _In_ const otai_attribute_t* attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::pair<otai_attr_id_t, std::string>> values;
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        auto md = otai_metadata_get_attr_metadata(objectType, attr_list[idx].id);
+
+        if (isStatic(md))
+        {
+            values.emplace_back(md->attrid, otai_serialize_attr_value(*md, attr_list[idx]));
+        }
+    }
+
+    if (values.empty())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (generation != m_generation)
+    {
+        // object could be removed while values were read, don't bring it back
+
+        return;
+    }
+
+    auto& attrs = m_objects[objectId];
+
+    for (auto& v: values)
+    {
+        attrs[v.first] = v.second;
+    }
+}
+
+bool StaticAttributeCache::tryGet(
+        _In_ otai_object_type_t objectType,
+        _In_ otai_object_id_t objectId,
+        _In_ uint32_t attr_count,
+        _Inout_ otai_attribute_t* attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<const std::string*> values(attr_count);
+
+    std::vector<const otai_attr_metadata_t*> mds(attr_count);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_objects.find(objectId);
+
+    if (it == m_objects.end() || attr_count == 0)
+    {
+        return false;
+    }
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        auto attr = it->second.find(attr_list[idx].id);
+
+        mds[idx] = otai_metadata_get_attr_metadata(objectType, attr_list[idx].id);
+
+        if (attr == it->second.end() || mds[idx] == NULL)
+        {
+            return false;
+        }
+
+        values[idx] = &attr->second;
+    }
+
+    // all values are present, only now user buffers are modified
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        otai_deserialize_attr_value(*values[idx], *mds[idx], attr_list[idx]);
+    }
+
+    return true;
+}
+
+void StaticAttributeCache::invalidate(
+        _In_ otai_object_id_t objectId,
+        _In_ otai_attr_id_t attrId)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_generation++;
+
+    auto it = m_objects.find(objectId);
+
+    if (it != m_objects.end())
+    {
+        it->second.erase(attrId);
+    }
+}
+
+void StaticAttributeCache::remove(
+        _In_ otai_object_id_t objectId)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_generation++;
+
+    m_objects.erase(objectId);
+}
+
+void StaticAttributeCache::clear()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_generation++;
+
+    m_objects.clear();
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+extern "C" {
+#include "otaimetadata.h"
+}
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace otairedis
+{
+    /**
+     * @brief Client side cache of attributes which don't change after
+     * object is created.
+     *
+     * Static attributes are create only attributes of non list type. Read
+     * only attributes are not cached, since inventory of pluggable modules
+     * changes on hot swap without linecard state change. Values are learned
+     * from create and from get responses and kept serialized. Object entries
+     * are dropped on remove, attribute entries on set, and whole cache is
+     * cleared on linecard state change.
+     *
+     * Get is not serialized by api mutex, so cache has its own mutex, and
+     * every removal bumps generation, so get response which raced with
+     * remove doesn't create entry again.
+     */
+    class StaticAttributeCache
+    {
+        public:
+
+            StaticAttributeCache();
+
+            virtual ~StaticAttributeCache() = default;
+
+        public:
+
+            static bool isStatic(
+                    _In_ const otai_attr_metadata_t* md);
+
+            /**
+             * @brief Get generation, to be passed to update after values
+             * were read without api mutex.
+             */
+            uint64_t getGeneration();
+
+            /**
+             * @brief Store values of static attributes from attribute list.
+             */
+            void update(
+                    _In_ otai_object_type_t objectType,
+                    _In_ otai_object_id_t objectId,
+                    _In_ uint32_t attr_count,
+                    _In_ const otai_attribute_t* attr_list);
+
+            /**
+             * @brief Store values only when nothing was removed or
+             * invalidated since generation was taken.
+             */
+            void update(
+                    _In_ otai_object_type_t objectType,
+                    _In_ otai_object_id_t objectId,
+                    _In_ uint64_t generation,
+                    _In_ uint32_t attr_count,
+                    _In_ const otai_attribute_t* attr_list);
+
+            /**
+             * @brief Fill attribute list from cache.
+             *
+             * @return True when all attributes were found in cache, list is
+             * not modified otherwise.
+             */
+            bool tryGet(
+                    _In_ otai_object_type_t objectType,
+                    _In_ otai_object_id_t objectId,
+                    _In_ uint32_t attr_count,
+                    _Inout_ otai_attribute_t* attr_list);
+
+            void invalidate(
+                    _In_ otai_object_id_t objectId,
+                    _In_ otai_attr_id_t attrId);
+
+            void remove(
+                    _In_ otai_object_id_t objectId);
+
+            void clear();
+
+        private:
+
+            std::mutex m_mutex;
+
+            uint64_t m_generation;
+
+            std::unordered_map<otai_object_id_t, std::map<otai_attr_id_t, std::string>> m_objects;
+    };
+}
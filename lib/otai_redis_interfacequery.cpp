@@ -1,4 +1,5 @@
 #include "otai_redis.h"
+#include "otairedis.h"
 
 using namespace otairedis;
 
@@ -96,6 +97,50 @@ otai_object_id_t otai_linecard_id_query(
     return redis_otai->linecardIdQuery(objectId);
 }
 
+otai_status_t otai_bulk_object_create(
+        _In_ otai_object_type_t object_type,
+        _In_ otai_object_id_t linecard_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const otai_attribute_t **attr_list,
+        _Out_ otai_object_id_t *object_id,
+        _Out_ otai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    return redis_otai->bulkCreate(
+            object_type,
+            linecard_id,
+            object_count,
+            attr_count,
+            attr_list,
+            object_id,
+            object_statuses);
+}
+
+otai_status_t otai_bulk_object_remove(
+        _In_ otai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const otai_object_id_t *object_id,
+        _Out_ otai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    return redis_otai->bulkRemove(object_type, object_count, object_id, object_statuses);
+}
+
+otai_status_t otai_bulk_object_set_attribute(
+        _In_ otai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const otai_object_id_t *object_id,
+        _In_ const otai_attribute_t *attr_list,
+        _Out_ otai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    return redis_otai->bulkSet(object_type, object_count, object_id, attr_list, object_statuses);
+}
+
 otai_status_t otai_dbg_generate_dump(
         _In_ const char *dump_file_name)
 {
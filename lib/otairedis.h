@@ -29,4 +29,122 @@ typedef enum _otai_redis_linecard_attr_t
      */
     OTAI_REDIS_LINECARD_ATTR_FLUSH = OTAI_LINECARD_ATTR_CUSTOM_RANGE_START,
 
+    /**
+     * @brief Asynchronous mode
+     *
+     * When enabled create/remove/set are buffered in redis pipeline and
+     * return success without waiting for syncd response. Pipeline is flushed
+     * when it's full, on OTAI_REDIS_LINECARD_ATTR_FLUSH and before any
+     * request which waits for response (get, stats, bulk). Failures are
+     * reported by OTAI_REDIS_LINECARD_ATTR_ASYNC_FAILURE_NOTIFY.
+     *
+     * Linecard object create/remove/set are always synchronous.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    OTAI_REDIS_LINECARD_ATTR_ASYNC_MODE,
+
+    /**
+     * @brief Async failure notification
+     *
+     * @type otai_pointer_t otai_redis_async_failure_notification_fn
+     * @flags CREATE_AND_SET
+     * @default NULL
+     */
+    OTAI_REDIS_LINECARD_ATTR_ASYNC_FAILURE_NOTIFY,
+
+    /**
+     * @brief Request trace threshold in microseconds
+     *
+     * When non zero, synchronous requests carry trace metadata, syncd adds
+     * its stage timestamps to response. Requests slower than threshold are
+     * logged with time breakdown and kept in ring of recent slow requests.
+     * Zero disables tracing.
+     *
+     * @type otai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    OTAI_REDIS_LINECARD_ATTR_TRACE_THRESHOLD,
+
+    /**
+     * @brief Log recent slow requests kept in trace ring and clear it
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    OTAI_REDIS_LINECARD_ATTR_TRACE_DUMP,
+
+    /**
+     * @brief Static attribute cache
+     *
+     * When enabled, values of create only attributes are cached in
+     * otairedis, and get of those is answered without syncd round trip.
+     * Cache is invalidated on set, remove and linecard state change.
+     * Disabling clears cache.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    OTAI_REDIS_LINECARD_ATTR_STATIC_ATTR_CACHE,
+
 } otai_redis_linecard_attr_t;
+
+/**
+ * @brief Called from notification thread when request sent in asynchronous
+ * mode failed in syncd.
+ *
+ * @param[in] key Original request key, OBJECT_TYPE:oid
+ * @param[in] op Request operation, create/remove/set
+ * @param[in] status Status returned by vendor
+ */
+typedef void (*otai_redis_async_failure_notification_fn)(
+        _In_ const char *key,
+        _In_ const char *op,
+        _In_ otai_status_t status);
+
+extern "C" {
+
+/**
+ * @brief Bulk create objects of single type.
+ *
+ * All objects are sent to syncd in single request and created in single
+ * round trip, status of each object is returned in object_statuses.
+ * Linecard object can't be created in bulk.
+ *
+ * @return #OTAI_STATUS_SUCCESS when all objects were created,
+ * #OTAI_STATUS_FAILURE when at least one object failed.
+ */
+otai_status_t otai_bulk_object_create(
+        _In_ otai_object_type_t object_type,
+        _In_ otai_object_id_t linecard_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const otai_attribute_t **attr_list,
+        _Out_ otai_object_id_t *object_id,
+        _Out_ otai_status_t *object_statuses);
+
+/**
+ * @brief Bulk remove objects of single type.
+ */
+otai_status_t otai_bulk_object_remove(
+        _In_ otai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const otai_object_id_t *object_id,
+        _Out_ otai_status_t *object_statuses);
+
+/**
+ * @brief Bulk set attribute, attr_list[i] is set on object_id[i].
+ */
+otai_status_t otai_bulk_object_set_attribute(
+        _In_ otai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const otai_object_id_t *object_id,
+        _In_ const otai_attribute_t *attr_list,
+        _Out_ otai_status_t *object_statuses);
+
+}
@@ -21,6 +21,10 @@
 #define REDIS_ASIC_STATE_COMMAND_SET    "set"
 #define REDIS_ASIC_STATE_COMMAND_GET    "get"
 
+#define REDIS_ASIC_STATE_COMMAND_BULK_CREATE "bulkcreate"
+#define REDIS_ASIC_STATE_COMMAND_BULK_REMOVE "bulkremove"
+#define REDIS_ASIC_STATE_COMMAND_BULK_SET    "bulkset"
+
 #define REDIS_ASIC_STATE_COMMAND_NOTIFY      "notify"
 
 #define REDIS_ASIC_STATE_COMMAND_GET_STATS          "get_stats"
@@ -28,6 +32,33 @@
 
 #define REDIS_ASIC_STATE_COMMAND_GETRESPONSE        "getresponse"
 
+/*
+ * Request metadata fields. They are appended by otairedis after attributes
+ * and stripped by syncd before request is processed.
+ */
+
+#define REDIS_ASIC_STATE_META_PREFIX    "REDIS_META_"
+
+/*
+ * Request was sent in asynchronous mode, syncd will not send response,
+ * failure is reported by async failure notification.
+ */
+#define REDIS_ASIC_STATE_META_ASYNC     "REDIS_META_ASYNC"
+
+/*
+ * Request correlation id, echoed by syncd as last field of response, so
+ * response can be matched with request when multiple requests are in flight.
+ */
+#define REDIS_ASIC_STATE_META_ID        "REDIS_META_ID"
+
+/*
+ * Request trace, stage timestamps of request. Client puts send time, syncd
+ * adds its stages and returns trace in response before correlation id.
+ */
+#define REDIS_ASIC_STATE_META_TRACE     "REDIS_META_TRACE"
+
+#define OTAI_REDIS_NOTIFICATION_NAME_ASYNC_FAILURE  "async_failure"
+
 // TODO move this to OTAI meta repository for auto generate
 
 #define OTAI_APS_NOTIFICATION_NAME_OLP_SWITCH_NOTIFY                 "olp_switch_notify"
@@ -0,0 +1,186 @@
+#include "RedisChannel.h"
+
+#include "otairediscommon.h"
+
+#include "meta/otai_serialize.h"
+
+#include "swss/logger.h"
+#include "swss/select.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+/*
+ * GET round trip micro benchmark of redis channel against local redis
+ * server. Thread in this process plays syncd and answers every get with
+ * success, so only channel and redis latency is measured. Syncd must not be
+ * running, since it would consume requests from the same queue.
+ *
+ * Usage: redis_channel_benchmark [iterations]
+ */
+
+#define BENCHMARK_DEFAULT_ITERATIONS    (10000)
+#define BENCHMARK_WARMUP_ITERATIONS     (100)
+
+using namespace otairedis;
+
+static std::atomic<bool> g_runResponder(true);
+
+static void responderThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    swss::DBConnector db("ASIC_DB", 0);
+
+    swss::ConsumerTable asicState(&db, ASIC_STATE_TABLE);
+    swss::ProducerTable getResponse(&db, REDIS_TABLE_GETRESPONSE);
+
+    swss::Select s;
+
+    s.addSelectable(&asicState);
+
+    while (g_runResponder)
+    {
+        swss::Selectable *sel;
+
+        if (s.select(&sel, 100) != swss::Select::OBJECT)
+        {
+            continue;
+        }
+
+        do
+        {
+            swss::KeyOpFieldsValuesTuple kco;
+
+            asicState.pop(kco);
+
+            if (kfvKey(kco).empty() || kfvOp(kco) != REDIS_ASIC_STATE_COMMAND_GET)
+            {
+                continue;
+            }
+
+            // echo attributes back, correlation id stays last
+
+            std::vector<swss::FieldValueTuple> entry = kfvFieldsValues(kco);
+
+            getResponse.set(otai_serialize_status(OTAI_STATUS_SUCCESS), entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+        }
+        while (!asicState.empty());
+    }
+}
+
+static uint64_t roundTrip(
+        _In_ RedisChannel& channel,
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    auto start = std::chrono::steady_clock::now();
+
+    uint64_t correlationId = channel.request(key, values, REDIS_ASIC_STATE_COMMAND_GET);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    otai_status_t status = channel.wait(REDIS_ASIC_STATE_COMMAND_GET, correlationId, kco);
+
+    auto end = std::chrono::steady_clock::now();
+
+    if (status != OTAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_THROW("get failed: %s", otai_serialize_status(status).c_str());
+    }
+
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    size_t iterations = BENCHMARK_DEFAULT_ITERATIONS;
+
+    if (argc > 1)
+    {
+        char *end = nullptr;
+
+        unsigned long long value = strtoull(argv[1], &end, 10);
+
+        if (end == argv[1] || *end != '\0' || value == 0)
+        {
+            fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+
+            return EXIT_FAILURE;
+        }
+
+        iterations = (size_t)value;
+    }
+
+    std::thread responder(responderThreadFunction);
+
+    int result = EXIT_SUCCESS;
+
+    try
+    {
+        RedisChannel channel("ASIC_DB",
+                [](const std::string&, const std::string&, const std::vector<swss::FieldValueTuple>&) {});
+
+        const std::string key = "OTAI_OBJECT_TYPE_LINECARD:oid:0x10000000000";
+
+        std::vector<swss::FieldValueTuple> values;
+
+        values.emplace_back("OTAI_LINECARD_ATTR_OPER_STATUS", "");
+
+        for (size_t i = 0; i < BENCHMARK_WARMUP_ITERATIONS; i++)
+        {
+            roundTrip(channel, key, values);
+        }
+
+        std::vector<uint64_t> samples;
+
+        samples.reserve(iterations);
+
+        for (size_t i = 0; i < iterations; i++)
+        {
+            samples.push_back(roundTrip(channel, key, values));
+        }
+
+        std::sort(samples.begin(), samples.end());
+
+        uint64_t total = 0;
+
+        for (auto sample: samples)
+        {
+            total += sample;
+        }
+
+        printf("get round trip, %zu iterations (us):\n", samples.size());
+        printf("  min %.1f avg %.1f p50 %.1f p99 %.1f max %.1f\n",
+                (double)samples.front() / 1000,
+                (double)total / (double)samples.size() / 1000,
+                (double)samples[samples.size() / 2] / 1000,
+                (double)samples[samples.size() * 99 / 100] / 1000,
+                (double)samples.back() / 1000);
+    }
+    catch (const std::exception& e)
+    {
+        fprintf(stderr, "benchmark failed: %s\n", e.what());
+
+        result = EXIT_FAILURE;
+    }
+
+    g_runResponder = false;
+
+    responder.join();
+
+    return result;
+}
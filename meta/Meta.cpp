@@ -255,6 +255,236 @@ otai_status_t Meta::get(
         SWSS_LOG_ERROR("parameter " #param " must be positive");                            \
         return OTAI_STATUS_INVALID_PARAMETER; } }
 
+#define PARAMETER_CHECK_NOT_LINECARD(ot) {                                                  \
+    if ((ot) == OTAI_OBJECT_TYPE_LINECARD) {                                                \
+        SWSS_LOG_ERROR("linecard object is not supported in bulk api");                     \
+        return OTAI_STATUS_INVALID_PARAMETER; } }
+
+otai_status_t Meta::bulkCreate(
+        _In_ otai_object_type_t object_type,
+        _In_ otai_object_id_t linecard_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const otai_attribute_t **attr_list,
+        _Out_ otai_object_id_t *object_id,
+        _Out_ otai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    PARAMETER_CHECK_OBJECT_TYPE_VALID(object_type);
+    PARAMETER_CHECK_NOT_LINECARD(object_type);
+    PARAMETER_CHECK_POSITIVE(object_count);
+    PARAMETER_CHECK_IF_NOT_NULL(attr_count);
+    PARAMETER_CHECK_IF_NOT_NULL(attr_list);
+    PARAMETER_CHECK_IF_NOT_NULL(object_id);
+    PARAMETER_CHECK_IF_NOT_NULL(object_statuses);
+
+    // only objects which passed validation are passed to implementation
+
+    std::vector<uint32_t> indexes;
+    std::vector<uint32_t> counts;
+    std::vector<const otai_attribute_t*> lists;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        object_id[idx] = OTAI_NULL_OBJECT_ID;
+
+        otai_object_meta_key_t meta_key = { .objecttype = object_type, .objectkey = { .key = { .object_id  = OTAI_NULL_OBJECT_ID } } };
+
+        otai_status_t status = meta_otai_validate_oid(object_type, &object_id[idx], linecard_id, true);
+
+        if (status == OTAI_STATUS_SUCCESS)
+        {
+            status = meta_generic_validation_create(meta_key, linecard_id, attr_count[idx], attr_list[idx]);
+        }
+
+        object_statuses[idx] = status;
+
+        if (status == OTAI_STATUS_SUCCESS)
+        {
+            indexes.push_back(idx);
+            counts.push_back(attr_count[idx]);
+            lists.push_back(attr_list[idx]);
+        }
+    }
+
+    if (indexes.size())
+    {
+        std::vector<otai_object_id_t> ids(indexes.size(), OTAI_NULL_OBJECT_ID);
+        std::vector<otai_status_t> statuses(indexes.size(), OTAI_STATUS_FAILURE);
+
+        m_implementation->bulkCreate(object_type, linecard_id, (uint32_t)indexes.size(),
+                counts.data(), lists.data(), ids.data(), statuses.data());
+
+        for (size_t i = 0; i < indexes.size(); i++)
+        {
+            uint32_t idx = indexes[i];
+
+            object_id[idx] = ids[i];
+            object_statuses[idx] = statuses[i];
+
+            if (statuses[i] != OTAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("bulk create object %u status: %s", idx, otai_serialize_status(statuses[i]).c_str());
+
+                continue;
+            }
+
+            otai_object_meta_key_t meta_key = { .objecttype = object_type, .objectkey = { .key = { .object_id  = ids[i] } } };
+
+            meta_generic_validation_post_create(meta_key, linecard_id, attr_count[idx], attr_list[idx]);
+        }
+    }
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        if (object_statuses[idx] != OTAI_STATUS_SUCCESS)
+        {
+            return OTAI_STATUS_FAILURE;
+        }
+    }
+
+    return OTAI_STATUS_SUCCESS;
+}
+
+otai_status_t Meta::bulkRemove(
+        _In_ otai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const otai_object_id_t *object_id,
+        _Out_ otai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    PARAMETER_CHECK_OBJECT_TYPE_VALID(object_type);
+    PARAMETER_CHECK_NOT_LINECARD(object_type);
+    PARAMETER_CHECK_POSITIVE(object_count);
+    PARAMETER_CHECK_IF_NOT_NULL(object_id);
+    PARAMETER_CHECK_IF_NOT_NULL(object_statuses);
+
+    std::vector<uint32_t> indexes;
+    std::vector<otai_object_id_t> ids;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        otai_object_meta_key_t meta_key = { .objecttype = object_type, .objectkey = { .key = { .object_id  = object_id[idx] } } };
+
+        otai_status_t status = meta_otai_validate_oid(object_type, &object_id[idx], OTAI_NULL_OBJECT_ID, false);
+
+        if (status == OTAI_STATUS_SUCCESS)
+        {
+            status = meta_generic_validation_remove(meta_key);
+        }
+
+        object_statuses[idx] = status;
+
+        if (status == OTAI_STATUS_SUCCESS)
+        {
+            indexes.push_back(idx);
+            ids.push_back(object_id[idx]);
+        }
+    }
+
+    if (indexes.size())
+    {
+        std::vector<otai_status_t> statuses(indexes.size(), OTAI_STATUS_FAILURE);
+
+        m_implementation->bulkRemove(object_type, (uint32_t)indexes.size(), ids.data(), statuses.data());
+
+        for (size_t i = 0; i < indexes.size(); i++)
+        {
+            object_statuses[indexes[i]] = statuses[i];
+
+            if (statuses[i] != OTAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("bulk remove %s status: %s",
+                        otai_serialize_object_id(ids[i]).c_str(),
+                        otai_serialize_status(statuses[i]).c_str());
+            }
+        }
+    }
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        if (object_statuses[idx] != OTAI_STATUS_SUCCESS)
+        {
+            return OTAI_STATUS_FAILURE;
+        }
+    }
+
+    return OTAI_STATUS_SUCCESS;
+}
+
+otai_status_t Meta::bulkSet(
+        _In_ otai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const otai_object_id_t *object_id,
+        _In_ const otai_attribute_t *attr_list,
+        _Out_ otai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    PARAMETER_CHECK_OBJECT_TYPE_VALID(object_type);
+    PARAMETER_CHECK_NOT_LINECARD(object_type);
+    PARAMETER_CHECK_POSITIVE(object_count);
+    PARAMETER_CHECK_IF_NOT_NULL(object_id);
+    PARAMETER_CHECK_IF_NOT_NULL(attr_list);
+    PARAMETER_CHECK_IF_NOT_NULL(object_statuses);
+
+    std::vector<uint32_t> indexes;
+    std::vector<otai_object_id_t> ids;
+    std::vector<otai_attribute_t> attrs;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        otai_object_meta_key_t meta_key = { .objecttype = object_type, .objectkey = { .key = { .object_id  = object_id[idx] } } };
+
+        otai_status_t status = meta_otai_validate_oid(object_type, &object_id[idx], OTAI_NULL_OBJECT_ID, false);
+
+        if (status == OTAI_STATUS_SUCCESS)
+        {
+            status = meta_generic_validation_set(meta_key, &attr_list[idx]);
+        }
+
+        object_statuses[idx] = status;
+
+        if (status == OTAI_STATUS_SUCCESS)
+        {
+            indexes.push_back(idx);
+            ids.push_back(object_id[idx]);
+            attrs.push_back(attr_list[idx]);
+        }
+    }
+
+    if (indexes.size())
+    {
+        std::vector<otai_status_t> statuses(indexes.size(), OTAI_STATUS_FAILURE);
+
+        m_implementation->bulkSet(object_type, (uint32_t)indexes.size(), ids.data(), attrs.data(), statuses.data());
+
+        for (size_t i = 0; i < indexes.size(); i++)
+        {
+            object_statuses[indexes[i]] = statuses[i];
+
+            if (statuses[i] != OTAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("bulk set %s status: %s",
+                        otai_serialize_object_id(ids[i]).c_str(),
+                        otai_serialize_status(statuses[i]).c_str());
+            }
+        }
+    }
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        if (object_statuses[idx] != OTAI_STATUS_SUCCESS)
+        {
+            return OTAI_STATUS_FAILURE;
+        }
+    }
+
+    return OTAI_STATUS_SUCCESS;
+}
+
 #define META_COUNTERS_COUNT_MSB (0x80000000)
 
 otai_status_t Meta::meta_validate_stats(
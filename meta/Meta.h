@@ -54,6 +54,30 @@ namespace otaimeta
                     _In_ uint32_t attr_count,
                     _Inout_ otai_attribute_t *attr_list) override;
 
+        public: // bulk QUAD oid
+
+            virtual otai_status_t bulkCreate(
+                    _In_ otai_object_type_t object_type,
+                    _In_ otai_object_id_t linecard_id,
+                    _In_ uint32_t object_count,
+                    _In_ const uint32_t *attr_count,
+                    _In_ const otai_attribute_t **attr_list,
+                    _Out_ otai_object_id_t *object_id,
+                    _Out_ otai_status_t *object_statuses) override;
+
+            virtual otai_status_t bulkRemove(
+                    _In_ otai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const otai_object_id_t *object_id,
+                    _Out_ otai_status_t *object_statuses) override;
+
+            virtual otai_status_t bulkSet(
+                    _In_ otai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const otai_object_id_t *object_id,
+                    _In_ const otai_attribute_t *attr_list,
+                    _Out_ otai_status_t *object_statuses) override;
+
         public: // stats API
 
             virtual otai_status_t getStats(
@@ -41,3 +41,76 @@ otai_status_t OtaiInterface::get(
 
     return get(metaKey.objecttype, metaKey.objectkey.key.object_id, attr_count, attr_list);
 }
+
+otai_status_t OtaiInterface::bulkCreate(
+        _In_ otai_object_type_t objectType,
+        _In_ otai_object_id_t linecardId,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const otai_attribute_t **attr_list,
+        _Out_ otai_object_id_t *object_id,
+        _Out_ otai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    otai_status_t status = OTAI_STATUS_SUCCESS;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        object_statuses[idx] = create(objectType, &object_id[idx], linecardId, attr_count[idx], attr_list[idx]);
+
+        if (object_statuses[idx] != OTAI_STATUS_SUCCESS)
+        {
+            status = OTAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
+
+otai_status_t OtaiInterface::bulkRemove(
+        _In_ otai_object_type_t objectType,
+        _In_ uint32_t object_count,
+        _In_ const otai_object_id_t *object_id,
+        _Out_ otai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    otai_status_t status = OTAI_STATUS_SUCCESS;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        object_statuses[idx] = remove(objectType, object_id[idx]);
+
+        if (object_statuses[idx] != OTAI_STATUS_SUCCESS)
+        {
+            status = OTAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
+
+otai_status_t OtaiInterface::bulkSet(
+        _In_ otai_object_type_t objectType,
+        _In_ uint32_t object_count,
+        _In_ const otai_object_id_t *object_id,
+        _In_ const otai_attribute_t *attr_list,
+        _Out_ otai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    otai_status_t status = OTAI_STATUS_SUCCESS;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        object_statuses[idx] = set(objectType, object_id[idx], &attr_list[idx]);
+
+        if (object_statuses[idx] != OTAI_STATUS_SUCCESS)
+        {
+            status = OTAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
@@ -69,6 +69,43 @@ namespace otairedis
                     _In_ uint32_t attr_count,
                     _Inout_ otai_attribute_t *attr_list);
 
+        public: // bulk QUAD oid
+
+            /**
+             * @brief Bulk create objects of single type on single linecard.
+             *
+             * Default implementation creates objects one by one, all objects
+             * are processed regardless of failures and per object status is
+             * returned in object_statuses.
+             *
+             * @return OTAI_STATUS_SUCCESS when all objects were created,
+             * OTAI_STATUS_FAILURE otherwise.
+             */
+            virtual otai_status_t bulkCreate(
+                    _In_ otai_object_type_t objectType,
+                    _In_ otai_object_id_t linecardId,
+                    _In_ uint32_t object_count,
+                    _In_ const uint32_t *attr_count,
+                    _In_ const otai_attribute_t **attr_list,
+                    _Out_ otai_object_id_t *object_id,
+                    _Out_ otai_status_t *object_statuses);
+
+            virtual otai_status_t bulkRemove(
+                    _In_ otai_object_type_t objectType,
+                    _In_ uint32_t object_count,
+                    _In_ const otai_object_id_t *object_id,
+                    _Out_ otai_status_t *object_statuses);
+
+            /**
+             * @brief Bulk set single attribute on each object.
+             */
+            virtual otai_status_t bulkSet(
+                    _In_ otai_object_type_t objectType,
+                    _In_ uint32_t object_count,
+                    _In_ const otai_object_id_t *object_id,
+                    _In_ const otai_attribute_t *attr_list,
+                    _Out_ otai_status_t *object_statuses);
+
         public: // stats API
 
             virtual otai_status_t getStats(
@@ -0,0 +1,314 @@
+#include "AlarmDamping.h"
+
+#include "swss/logger.h"
+
+#include "nlohmann/json.hpp"
+
+#include <cmath>
+#include <fstream>
+
+using namespace syncd;
+using json = nlohmann::json;
+
+// entries with penalty below this value and alarm cleared are forgotten
+
+#define ALARM_DAMPING_PENALTY_EPSILON (1.0)
+
+static AlarmDamping::Config parseConfig(
+        _In_ const json& j,
+        _In_ const AlarmDamping::Config& base)
+{
+    SWSS_LOG_ENTER();
+
+    AlarmDamping::Config config = base;
+
+    config.m_holdDownMs = j.value("hold-down-ms", config.m_holdDownMs);
+    config.m_penalty = j.value("penalty", config.m_penalty);
+    config.m_maxPenalty = j.value("max-penalty", config.m_maxPenalty);
+    config.m_suppress = j.value("suppress", config.m_suppress);
+    config.m_reuse = j.value("reuse", config.m_reuse);
+    config.m_halfLife = j.value("half-life-s", config.m_halfLife);
+
+    if (config.m_halfLife <= 0)
+    {
+        SWSS_LOG_THROW("half-life-s must be positive");
+    }
+
+    if (config.m_reuse > config.m_suppress)
+    {
+        SWSS_LOG_THROW("reuse %f must not exceed suppress %f", config.m_reuse, config.m_suppress);
+    }
+
+    return config;
+}
+
+AlarmDamping::AlarmDamping(
+        _In_ const Config& defaultConfig,
+        _In_ const std::map<std::string, Config>& typeConfigs):
+    m_defaultConfig(defaultConfig),
+    m_typeConfigs(typeConfigs)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+std::shared_ptr<AlarmDamping> AlarmDamping::loadFromFile(
+        _In_ const std::string& path)
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream file(path);
+
+    if (!file.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open alarm damping config %s", path.c_str());
+
+        return nullptr;
+    }
+
+    try
+    {
+        json j = json::parse(file);
+
+        Config defaultConfig = { 0, 1000, 8000, 2000, 750, 15 };
+
+        if (j.find(ALARM_DAMPING_DEFAULT_CONFIG) != j.end())
+        {
+            defaultConfig = parseConfig(j[ALARM_DAMPING_DEFAULT_CONFIG], defaultConfig);
+        }
+
+        std::map<std::string, Config> typeConfigs;
+
+        for (auto it = j.begin(); it != j.end(); ++it)
+        {
+            if (it.key() == ALARM_DAMPING_DEFAULT_CONFIG)
+            {
+                continue;
+            }
+
+            typeConfigs[it.key()] = parseConfig(it.value(), defaultConfig);
+        }
+
+        SWSS_LOG_NOTICE("loaded alarm damping config %s, %zu alarm types", path.c_str(), typeConfigs.size());
+
+        return std::make_shared<AlarmDamping>(defaultConfig, typeConfigs);
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to parse alarm damping config %s: %s", path.c_str(), e.what());
+    }
+
+    return nullptr;
+}
+
+const AlarmDamping::Config& AlarmDamping::getConfig(
+        _In_ const std::string& typeId) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_typeConfigs.find(typeId);
+
+    return it == m_typeConfigs.end() ? m_defaultConfig : it->second;
+}
+
+void AlarmDamping::decay(
+        _Inout_ Entry& entry,
+        _In_ time_point_t now) const
+{
+    SWSS_LOG_ENTER();
+
+    double elapsed = std::chrono::duration<double>(now - entry.m_updateTime).count();
+
+    if (elapsed > 0)
+    {
+        entry.m_penalty *= std::exp2(-elapsed / entry.m_config->m_halfLife);
+    }
+
+    entry.m_updateTime = now;
+}
+
+bool AlarmDamping::update(
+        _In_ const std::string& key,
+        _In_ const std::string& typeId,
+        _In_ bool active,
+        _In_ const std::string& data,
+        _In_ time_point_t now)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(key);
+
+    if (it == m_entries.end())
+    {
+        Entry entry = { &getConfig(typeId), 0, now, false, false, false, now, 0, "" };
+
+        it = m_entries.emplace(key, entry).first;
+    }
+
+    Entry& entry = it->second;
+
+    decay(entry, now);
+
+    bool wasActive = entry.m_active;
+
+    entry.m_active = active;
+    entry.m_data = data;
+
+    if (active)
+    {
+        if (!wasActive && entry.m_penalty >= ALARM_DAMPING_PENALTY_EPSILON)
+        {
+            // raise after clear while previous raise still has penalty
+
+            entry.m_flaps++;
+        }
+
+        entry.m_penalty = std::min(entry.m_penalty + entry.m_config->m_penalty, entry.m_config->m_maxPenalty);
+
+        if (!entry.m_suppressed && entry.m_penalty >= entry.m_config->m_suppress)
+        {
+            SWSS_LOG_NOTICE("alarm %s suppressed, penalty %.0f", key.c_str(), entry.m_penalty);
+
+            entry.m_suppressed = true;
+        }
+    }
+
+    if (entry.m_suppressed)
+    {
+        return false;
+    }
+
+    if (active && entry.m_pendingClear)
+    {
+        // raise within hold down, alarm never reported as cleared
+
+        entry.m_pendingClear = false;
+
+        return false;
+    }
+
+    if (!active && entry.m_config->m_holdDownMs)
+    {
+        entry.m_pendingClear = true;
+        entry.m_clearDeadline = now + std::chrono::milliseconds(entry.m_config->m_holdDownMs);
+
+        return false;
+    }
+
+    return true;
+}
+
+void AlarmDamping::expire(
+        _In_ time_point_t now,
+        _Out_ std::vector<Settled>& settled)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        Entry& entry = it->second;
+
+        decay(entry, now);
+
+        if (entry.m_suppressed && entry.m_penalty < entry.m_config->m_reuse)
+        {
+            SWSS_LOG_NOTICE("alarm %s reused, %u flaps", it->first.c_str(), entry.m_flaps);
+
+            entry.m_suppressed = false;
+            entry.m_pendingClear = false;
+
+            settled.push_back({ it->first, entry.m_active, entry.m_data });
+        }
+        else if (!entry.m_suppressed && entry.m_pendingClear && now >= entry.m_clearDeadline)
+        {
+            entry.m_pendingClear = false;
+
+            settled.push_back({ it->first, false, entry.m_data });
+        }
+
+        if (!entry.m_active && !entry.m_suppressed && !entry.m_pendingClear &&
+                entry.m_flaps == 0 && entry.m_penalty < ALARM_DAMPING_PENALTY_EPSILON)
+        {
+            it = m_entries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void AlarmDamping::reset()
+{
+    SWSS_LOG_ENTER();
+
+    m_entries.clear();
+}
+
+bool AlarmDamping::getNextDeadline(
+        _Out_ time_point_t& deadline) const
+{
+    SWSS_LOG_ENTER();
+
+    bool found = false;
+
+    for (auto& kv: m_entries)
+    {
+        const Entry& entry = kv.second;
+
+        time_point_t time;
+
+        if (entry.m_suppressed)
+        {
+            // penalty halves every half life, reuse is reached after
+            // log2(penalty / reuse) half lives, rounded up by a millisecond
+            // so penalty is surely below reuse at deadline
+
+            double seconds = 0;
+
+            if (entry.m_config->m_reuse > 0 && entry.m_penalty > entry.m_config->m_reuse)
+            {
+                seconds = entry.m_config->m_halfLife * std::log2(entry.m_penalty / entry.m_config->m_reuse);
+            }
+
+            time = entry.m_updateTime + std::chrono::duration_cast<time_point_t::duration>(
+                    std::chrono::duration<double>(seconds)) + std::chrono::milliseconds(1);
+        }
+        else if (entry.m_pendingClear)
+        {
+            time = entry.m_clearDeadline;
+        }
+        else
+        {
+            continue;
+        }
+
+        if (!found || time < deadline)
+        {
+            deadline = time;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+uint32_t AlarmDamping::takeFlapCount(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(key);
+
+    if (it == m_entries.end())
+    {
+        return 0;
+    }
+
+    uint32_t flaps = it->second.m_flaps;
+
+    it->second.m_flaps = 0;
+
+    return flaps;
+}
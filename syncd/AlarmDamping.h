@@ -0,0 +1,162 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define ALARM_DAMPING_DEFAULT_CONFIG "default"
+
+namespace syncd
+{
+    /**
+     * @brief Flap damping of linecard alarms.
+     *
+     * Every raise adds penalty to alarm, penalty decays exponentially with
+     * configured half life. When penalty exceeds suppress threshold, alarm
+     * transitions are held until penalty decays below reuse threshold, then
+     * the settled state is reported once. Independently clear can be held
+     * down, raise within hold down time cancels the clear.
+     *
+     * Raises following a clear are counted as flaps, count is reported with
+     * the clear which ends the burst.
+     */
+    class AlarmDamping
+    {
+        public:
+
+            typedef std::chrono::steady_clock::time_point time_point_t;
+
+            struct Config
+            {
+                uint32_t m_holdDownMs;
+
+                double m_penalty;
+
+                double m_maxPenalty;
+
+                double m_suppress;
+
+                double m_reuse;
+
+                double m_halfLife;
+            };
+
+            /**
+             * @brief Alarm state which was held and settled, must be
+             * reported now.
+             */
+            struct Settled
+            {
+                std::string m_key;
+
+                bool m_active;
+
+                std::string m_data;
+            };
+
+        public:
+
+            AlarmDamping(
+                    _In_ const Config& defaultConfig,
+                    _In_ const std::map<std::string, Config>& typeConfigs);
+
+            virtual ~AlarmDamping() = default;
+
+        public:
+
+            /**
+             * @brief Load damping configuration from json file.
+             *
+             * File has "default" object and optional objects per alarm
+             * type id, with fields hold-down-ms, penalty, max-penalty,
+             * suppress, reuse and half-life-s.
+             *
+             * @return Damping instance or nullptr when file can't be loaded.
+             */
+            static std::shared_ptr<AlarmDamping> loadFromFile(
+                    _In_ const std::string& path);
+
+            /**
+             * @brief Update alarm state.
+             *
+             * @return True when transition should be reported now, false
+             * when it is held.
+             */
+            bool update(
+                    _In_ const std::string& key,
+                    _In_ const std::string& typeId,
+                    _In_ bool active,
+                    _In_ const std::string& data,
+                    _In_ time_point_t now);
+
+            /**
+             * @brief Collect held alarms whose hold down expired or whose
+             * penalty decayed below reuse threshold.
+             */
+            void expire(
+                    _In_ time_point_t now,
+                    _Out_ std::vector<Settled>& settled);
+
+            /**
+             * @brief Forget state of all alarms.
+             */
+            void reset();
+
+            /**
+             * @brief Get earliest time when expire can settle held alarm.
+             *
+             * @return False when no alarm is held.
+             */
+            bool getNextDeadline(
+                    _Out_ time_point_t& deadline) const;
+
+            /**
+             * @brief Get flaps counted since last call and reset counter.
+             */
+            uint32_t takeFlapCount(
+                    _In_ const std::string& key);
+
+        private:
+
+            struct Entry
+            {
+                const Config* m_config;
+
+                double m_penalty;
+
+                time_point_t m_updateTime;
+
+                bool m_active;
+
+                bool m_suppressed;
+
+                bool m_pendingClear;
+
+                time_point_t m_clearDeadline;
+
+                uint32_t m_flaps;
+
+                std::string m_data;
+            };
+
+            const Config& getConfig(
+                    _In_ const std::string& typeId) const;
+
+            void decay(
+                    _Inout_ Entry& entry,
+                    _In_ time_point_t now) const;
+
+        private:
+
+            Config m_defaultConfig;
+
+            std::map<std::string, Config> m_typeConfigs;
+
+            std::unordered_map<std::string, Entry> m_entries;
+    };
+}
@@ -0,0 +1,145 @@
+#include "AttributeCache.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+AttributeCache::AttributeCache():
+    m_hits(0),
+    m_misses(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+bool AttributeCache::isCacheable(
+        _In_ const otai_attr_metadata_t* md)
+{
+    SWSS_LOG_ENTER();
+
+    if (md == NULL || md->isoidattribute)
+    {
+        return false;
+    }
+
+    if (OTAI_HAS_FLAG_READ_ONLY(md->flags) || OTAI_HAS_FLAG_SET_ONLY(md->flags))
+    {
+        return false;
+    }
+
+    switch (md->attrvaluetype)
+    {
+        case OTAI_ATTR_VALUE_TYPE_BOOL:
+        case OTAI_ATTR_VALUE_TYPE_UINT8:
+        case OTAI_ATTR_VALUE_TYPE_INT8:
+        case OTAI_ATTR_VALUE_TYPE_UINT16:
+        case OTAI_ATTR_VALUE_TYPE_INT16:
+        case OTAI_ATTR_VALUE_TYPE_UINT32:
+        case OTAI_ATTR_VALUE_TYPE_INT32:
+        case OTAI_ATTR_VALUE_TYPE_UINT64:
+        case OTAI_ATTR_VALUE_TYPE_INT64:
+        case OTAI_ATTR_VALUE_TYPE_DOUBLE:
+        case OTAI_ATTR_VALUE_TYPE_CHARDATA:
+        case OTAI_ATTR_VALUE_TYPE_UINT32_RANGE:
+        case OTAI_ATTR_VALUE_TYPE_INT32_RANGE:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+void AttributeCache::update(
+        _In_ otai_object_type_t objectType,
+        _In_ otai_object_id_t vid,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto& v: values)
+    {
+        auto md = otai_metadata_get_attr_metadata_by_attr_id_name(fvField(v).c_str());
+
+        if (md == NULL || md->objecttype != objectType || !isCacheable(md))
+        {
+            continue;
+        }
+
+        m_objects[vid][md->attrid] = fvValue(v);
+    }
+}
+
+void AttributeCache::remove(
+        _In_ otai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    m_objects.erase(vid);
+}
+
+void AttributeCache::clear()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("clearing attribute cache of %zu objects", m_objects.size());
+
+    m_objects.clear();
+}
+
+bool AttributeCache::tryGet(
+        _In_ otai_object_type_t objectType,
+        _In_ otai_object_id_t vid,
+        _In_ uint32_t attr_count,
+        _In_ const otai_attribute_t* attr_list,
+        _Out_ std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    values.clear();
+
+    auto it = m_objects.find(vid);
+
+    if (it == m_objects.end() || attr_count == 0)
+    {
+        m_misses++;
+
+        return false;
+    }
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        auto md = otai_metadata_get_attr_metadata(objectType, attr_list[idx].id);
+
+        auto attr = it->second.find(attr_list[idx].id);
+
+        if (md == NULL || attr == it->second.end())
+        {
+            m_misses++;
+
+            values.clear();
+
+            return false;
+        }
+
+        values.emplace_back(md->attridname, attr->second);
+    }
+
+    m_hits++;
+
+    return true;
+}
+
+void AttributeCache::publish(
+        _In_ swss::Table& table) const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("hits", std::to_string(m_hits));
+    values.emplace_back("misses", std::to_string(m_misses));
+    values.emplace_back("objects", std::to_string(m_objects.size()));
+
+    table.set("GET", values);
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+extern "C" {
+#include "otaimetadata.h"
+}
+
+#include "swss/table.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Attribute cache hit/miss counters in STATE_DB, refreshed by main loop
+ * together with latency statistics.
+ */
+#define ATTRIBUTE_CACHE_STATS_TABLE "SYNCD_ATTRIBUTE_CACHE_STATS"
+
+namespace syncd
+{
+    /**
+     * @brief Cache of attribute values last created or set by syncd.
+     *
+     * Only attributes which hardware doesn't change on its own are cached:
+     * not read only, gettable, and of scalar, chardata, enum or range type.
+     * Object id and list attributes are not cached, since their value
+     * depends on other objects and on user buffer size.
+     *
+     * Values are kept serialized with VIDs, as they are in ASIC DB. Cache is
+     * used from main loop only.
+     */
+    class AttributeCache
+    {
+        public:
+
+            AttributeCache();
+
+            virtual ~AttributeCache() = default;
+
+        public:
+
+            static bool isCacheable(
+                    _In_ const otai_attr_metadata_t* md);
+
+            /**
+             * @brief Update cache after successful create or set.
+             */
+            void update(
+                    _In_ otai_object_type_t objectType,
+                    _In_ otai_object_id_t vid,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+            void remove(
+                    _In_ otai_object_id_t vid);
+
+            void clear();
+
+            /**
+             * @brief Get serialized values of all requested attributes.
+             *
+             * @return True when all attributes were found in cache, false
+             * when at least one must be read from hardware.
+             */
+            bool tryGet(
+                    _In_ otai_object_type_t objectType,
+                    _In_ otai_object_id_t vid,
+                    _In_ uint32_t attr_count,
+                    _In_ const otai_attribute_t* attr_list,
+                    _Out_ std::vector<swss::FieldValueTuple>& values);
+
+            void publish(
+                    _In_ swss::Table& table) const;
+
+        private:
+
+            std::unordered_map<otai_object_id_t, std::unordered_map<otai_attr_id_t, std::string>> m_objects;
+
+            uint64_t m_hits;
+
+            uint64_t m_misses;
+    };
+}
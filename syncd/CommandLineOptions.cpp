@@ -20,6 +20,10 @@ CommandLineOptions::CommandLineOptions()
 
     m_profileMapFile = "";
 
+    m_ocmStorageMode = OCM_STORAGE_MODE_CHANNEL;
+
+    m_alarmDampingConfig = "";
+
 }
 
 std::string CommandLineOptions::getCommandLineString() const
@@ -30,6 +34,8 @@ std::string CommandLineOptions::getCommandLineString() const
 
     ss << " EnableOtaiBulkSuport=" << (m_enableOtaiBulkSupport ? "YES" : "NO");
     ss << " ProfileMapFile=" << m_profileMapFile;
+    ss << " OcmStorageMode=" << m_ocmStorageMode;
+    ss << " AlarmDampingConfig=" << m_alarmDampingConfig;
 
     return ss.str();
 }
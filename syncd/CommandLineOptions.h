@@ -6,6 +6,15 @@
 
 #include <string>
 
+/*
+ * OCM spectrum storage in STATE_DB:
+ * - channel: key per channel <name>|<lower>|<upper> in OCM table,
+ * - packed: one hash per OCM in OCM_SPECTRUM_POWER table, fields
+ *   <lower>|<upper> with channel power.
+ */
+#define OCM_STORAGE_MODE_CHANNEL    "channel"
+#define OCM_STORAGE_MODE_PACKED     "packed"
+
 namespace syncd
 {
     class CommandLineOptions
@@ -26,5 +35,9 @@ namespace syncd
             std::string m_profileMapFile;
 
 			uint32_t m_loglevel;
+
+            std::string m_ocmStorageMode;
+
+            std::string m_alarmDampingConfig;
     };
 }
@@ -17,7 +17,7 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
     SWSS_LOG_ENTER();
 
     auto options = std::make_shared<CommandLineOptions>();
-    const char* const optstring = "p:f:lh";
+    const char* const optstring = "p:f:o:d:lh";
 
     while (true)
     {
@@ -25,6 +25,8 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
         {
             { "profile",                 required_argument, 0, 'p' },
             { "enableOtaiBulkSupport",    no_argument,       0, 'l' },
+            { "ocmStorage",              required_argument, 0, 'o' },
+            { "alarmDamping",            required_argument, 0, 'd' },
             { "help",                    no_argument,       0, 'h' },
             { 0,                         0,                 0,  0  }
         };
@@ -48,6 +50,22 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
                 options->m_enableOtaiBulkSupport = true;
                 break;
 
+            case 'o':
+                options->m_ocmStorageMode = std::string(optarg);
+
+                if (options->m_ocmStorageMode != OCM_STORAGE_MODE_CHANNEL &&
+                    options->m_ocmStorageMode != OCM_STORAGE_MODE_PACKED)
+                {
+                    SWSS_LOG_ERROR("unknown OCM storage mode %s", optarg);
+                    printUsage();
+                    exit(EXIT_FAILURE);
+                }
+                break;
+
+            case 'd':
+                options->m_alarmDampingConfig = std::string(optarg);
+                break;
+
             case 'h':
                 printUsage();
                 exit(EXIT_SUCCESS);
@@ -70,11 +88,15 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
 void CommandLineOptionsParser::printUsage()
 {
     SWSS_LOG_ENTER();
-    std::cout << "Usage: syncd [-p profile] [-l] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-p profile] [-l] [-o channel|packed] [-d damping] [-h]" << std::endl;
     std::cout << "    -p --profile profile" << std::endl;
     std::cout << "        Provide profile map file" << std::endl;
     std::cout << "    -l --enableBulk" << std::endl;
     std::cout << "        Enable OTAI Bulk support" << std::endl;
+    std::cout << "    -o --ocmStorage channel|packed" << std::endl;
+    std::cout << "        OCM spectrum storage, key per channel (default) or one key per OCM" << std::endl;
+    std::cout << "    -d --alarmDamping damping" << std::endl;
+    std::cout << "        Provide linecard alarm flap damping config file, damping is disabled by default" << std::endl;
     std::cout << "    -h --help" << std::endl;
     std::cout << "        Print out this message" << std::endl;
 }
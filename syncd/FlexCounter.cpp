@@ -1,7 +1,9 @@
+#include <cerrno>
 #include <cinttypes>
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #include "FlexCounter.h"
 #include "VidManager.h"
@@ -13,17 +15,33 @@
 #include "swss/tokenize.h"
 
 using namespace syncd;
+using namespace std::placeholders;
 
 #define MUTEX std::unique_lock<std::mutex> _lock(m_mtx);
 #define MUTEX_UNLOCK _lock.unlock();
 
+#define PRIORITY_MUTEX std::unique_lock<std::mutex> _priorityLock(m_priorityMtx);
+#define PRIORITY_MUTEX_UNLOCK _priorityLock.unlock();
+
+#define HIGH_PRIORITY_LANE  "high_priority"
+#define BULK_LANE           "bulk"
+
+#define LANE_STATS_PUBLISH_INTERVAL_MS (1000)
+
 FlexCounter::FlexCounter(
     _In_ const std::string& instanceId,
     _In_ std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
-    _In_ const std::string& dbCounters):
+    _In_ const std::string& dbCounters,
+    _In_ std::shared_ptr<NotificationHandler> handler):
     m_pollInterval(0),
     m_instanceId(instanceId),
-    m_vendorOtai(vendorOtai)
+    m_vendorOtai(vendorOtai),
+    m_dbCounters(dbCounters),
+    m_handler(handler),
+    m_changeFeedEnabled(false),
+    m_runPriorityThread(false),
+    m_priorityPollNotified(false),
+    m_priorityPollInterval(HIGH_PRIORITY_DEFAULT_POLL_INTERVAL)
 {
     SWSS_LOG_ENTER();
 
@@ -45,13 +63,38 @@ FlexCounter::FlexCounter(
     m_enable = false;
     m_isDiscarded = false;
 
+    setRateWindows(DEFAULT_RATE_WINDOWS);
+
+    // attribute collectors write to STATE_DB, others to counters db
+
+    std::string feedDb = (m_propGroup == OTAI_PROPERTY_GROUP_ATTR) ? "STATE_DB" : m_dbCounters;
+
+    m_bulkChangeFeed = std::make_shared<ChangeFeed>(feedDb, m_instanceId);
+
+    if (m_propGroup == OTAI_PROPERTY_GROUP_GAUGE)
+    {
+        m_priorityChangeFeed = std::make_shared<ChangeFeed>(feedDb, m_instanceId);
+    }
+
+    if (m_handler != nullptr)
+    {
+        m_thresholdReporter = std::bind(&NotificationHandler::onThresholdCrossing, m_handler.get(), _1, _2, _3, _4, _5, _6);
+    }
+
     startFlexCounterThread();
+
+    if (m_propGroup == OTAI_PROPERTY_GROUP_GAUGE)
+    {
+        startPriorityThread();
+    }
 }
 
 FlexCounter::~FlexCounter(void)
 {
     SWSS_LOG_ENTER();
 
+    endPriorityThread();
+
     endFlexCounterThread();
 
     MUTEX;
@@ -61,6 +104,10 @@ FlexCounter::~FlexCounter(void)
         delete c->second;
     }
 
+    for (auto c = m_priorityCollectors.begin(); c != m_priorityCollectors.end(); c++)
+    {
+        delete c->second;
+    }
 }
 
 void FlexCounter::setPollInterval(
@@ -113,6 +160,106 @@ void FlexCounter::setStatsMode(
     }
 }
 
+void FlexCounter::setChangeFeed(
+    _In_ const std::string& status)
+{
+    SWSS_LOG_ENTER();
+
+    bool enable;
+
+    if (status == "enable")
+    {
+        enable = true;
+    }
+    else if (status == "disable")
+    {
+        enable = false;
+    }
+    else
+    {
+        SWSS_LOG_WARN("Input value %s is not supported for Flex counter change feed, enter enable or disable", status.c_str());
+        return;
+    }
+
+    if (enable == m_changeFeedEnabled)
+    {
+        return;
+    }
+
+    m_changeFeedEnabled = enable;
+
+    SWSS_LOG_NOTICE("Change feed %s for instance %s", status.c_str(), m_instanceId.c_str());
+
+    for (auto& kv: m_collectors)
+    {
+        kv.second->setChangeFeed(enable ? m_bulkChangeFeed : nullptr);
+    }
+
+    for (auto& kv: m_priorityCollectors)
+    {
+        kv.second->setChangeFeed(enable ? m_priorityChangeFeed : nullptr);
+    }
+}
+
+void FlexCounter::setRateWindows(
+    _In_ const std::string& windows)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<uint32_t> rateWindows;
+
+    for (auto& str: swss::tokenize(windows, ','))
+    {
+        if (str.empty())
+        {
+            continue;
+        }
+
+        int window = atoi(str.c_str());
+
+        if (window <= 0)
+        {
+            SWSS_LOG_WARN("Input value %s is not supported for Flex counter rate window, enter seconds", str.c_str());
+            continue;
+        }
+
+        rateWindows.push_back((uint32_t)window);
+    }
+
+    m_rateWindows = rateWindows;
+
+    if (m_propGroup != OTAI_PROPERTY_GROUP_STAT)
+    {
+        return;
+    }
+
+    for (auto& kv: m_collectors)
+    {
+        static_cast<OtaiStatCollector*>(kv.second)->setRateWindows(m_rateWindows);
+    }
+}
+
+void FlexCounter::setPriorityPollInterval(
+    _In_ const std::string& interval)
+{
+    SWSS_LOG_ENTER();
+
+    char *end = nullptr;
+
+    errno = 0;
+
+    unsigned long value = strtoul(interval.c_str(), &end, 10);
+
+    if (interval.empty() || *end != '\0' || errno == ERANGE || interval[0] == '-' || value > UINT32_MAX)
+    {
+        SWSS_LOG_ERROR("Input value %s is not supported for Flex counter high priority poll interval on instance %s, enter milliseconds",
+                       interval.c_str(), m_instanceId.c_str());
+        return;
+    }
+
+    m_priorityPollInterval = (uint32_t)value;
+}
+
 void FlexCounter::addCollectCountersHandler(const std::string& key, const collect_counters_handler_t& handler)
 {
     SWSS_LOG_ENTER();
@@ -152,6 +299,13 @@ void FlexCounter::addCounterPlugin(
 
     m_isDiscarded = false;
 
+    PRIORITY_MUTEX;
+
+    auto highPriorityStatIds = m_highPriorityStatIds;
+    auto highPriorityObjects = m_highPriorityObjects;
+
+    bool thresholdsChanged = false;
+
     for (auto& fvt : values)
     {
         auto& field = fvField(fvt);
@@ -171,14 +325,80 @@ void FlexCounter::addCounterPlugin(
         {
             setStatsMode(value);
         }
+        else if (field == RATE_WINDOWS_FIELD)
+        {
+            setRateWindows(value);
+        }
+        else if (field == CHANGE_FEED_FIELD)
+        {
+            setChangeFeed(value);
+        }
+        else if (field == HIGH_PRIORITY_POLL_INTERVAL_FIELD)
+        {
+            setPriorityPollInterval(value);
+        }
+        else if (field == HIGH_PRIORITY_STAT_IDS_FIELD)
+        {
+            highPriorityStatIds = std::set<std::string>(shaStrings.begin(), shaStrings.end());
+        }
+        else if (field == HIGH_PRIORITY_OBJECTS_FIELD)
+        {
+            highPriorityObjects.clear();
+
+            for (auto& str: shaStrings)
+            {
+                otai_object_id_t vid;
+
+                otai_deserialize_object_id(str, vid);
+
+                highPriorityObjects.insert(vid);
+            }
+        }
+        else if (field.find(THRESHOLD_FIELD_PREFIX) == 0)
+        {
+            thresholdsChanged |= updateThreshold(field, value, m_thresholds);
+        }
         else
         {
             SWSS_LOG_ERROR("Field is not supported %s", field.c_str());
         }
     }
 
-    // notify thread to start polling
+    if (thresholdsChanged && m_propGroup == OTAI_PROPERTY_GROUP_GAUGE)
+    {
+        for (auto& kv: m_collectors)
+        {
+            static_cast<OtaiGaugeCollector*>(kv.second)->setThresholds(getThresholds(kv.first));
+        }
+
+        for (auto& kv: m_priorityCollectors)
+        {
+            static_cast<OtaiGaugeCollector*>(kv.second)->setThresholds(getThresholds(kv.first));
+        }
+    }
+
+    bool priorityChanged = (highPriorityStatIds != m_highPriorityStatIds ||
+                            highPriorityObjects != m_highPriorityObjects);
+
+    m_highPriorityStatIds = highPriorityStatIds;
+    m_highPriorityObjects = highPriorityObjects;
+
+    PRIORITY_MUTEX_UNLOCK;
+
+    if (priorityChanged && m_propGroup == OTAI_PROPERTY_GROUP_GAUGE)
+    {
+        SWSS_LOG_NOTICE("High priority selection changed for instance %s, rebuilding %zu collectors",
+                        m_instanceId.c_str(), m_counterConfigs.size());
+
+        for (auto& kv: m_counterConfigs)
+        {
+            installCollectors(kv.first);
+        }
+    }
+
+    // notify threads to start polling
     m_pollCond.notify_all();
+    notifyPriorityThread();
 }
 
 bool FlexCounter::isEmpty()
@@ -200,7 +420,8 @@ bool FlexCounter::isDiscarded()
 bool FlexCounter::allIdsEmpty()
 {
     SWSS_LOG_ENTER();
-    return m_collectors.empty();
+
+    return m_collectors.empty() && m_priorityCollectors.empty();
 }
 
 bool FlexCounter::allPluginsEmpty() const
@@ -230,11 +451,14 @@ void FlexCounter::flexCounterThreadRunFunction()
 {
     SWSS_LOG_ENTER();
 
+    swss::DBConnector db(m_dbCounters, 0);
+    swss::Table laneStatsTable(&db, FLEX_COUNTER_LANE_STATS_TABLE);
+
     while (m_runFlexCounterThread)
     {
         MUTEX;
 
-        if (m_enable && !allIdsEmpty() && (m_pollInterval > 0))
+        if (m_enable && !m_collectors.empty() && (m_pollInterval > 0))
         {
             auto start = std::chrono::steady_clock::now();
 
@@ -242,13 +466,18 @@ void FlexCounter::flexCounterThreadRunFunction()
 
             auto finish = std::chrono::steady_clock::now();
 
+            m_bulkChangeFeed->publish();
+
             uint32_t delay = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(finish - start).count());
 
-            uint32_t correction = delay % m_pollInterval;
-            correction = m_pollInterval - correction;
+            uint32_t interval = m_pollInterval;
+            uint32_t correction = delay % interval;
+            correction = interval - correction;
             MUTEX_UNLOCK; // explicit unlock
 
-            SWSS_LOG_DEBUG("End of Flex_Counter cycle [%s], took %d ms / interval %d ms", m_instanceId.c_str(), delay, m_pollInterval);
+            SWSS_LOG_DEBUG("End of Flex_Counter cycle [%s], took %d ms / interval %d ms", m_instanceId.c_str(), delay, interval);
+
+            updateLaneStatistics(BULK_LANE, m_bulkLaneStats, delay, interval, false, laneStatsTable);
 
             std::unique_lock<std::mutex> lk(m_mtxSleep);
             m_cvSleep.wait_for(lk, std::chrono::milliseconds(correction));
@@ -257,7 +486,7 @@ void FlexCounter::flexCounterThreadRunFunction()
         {
             MUTEX_UNLOCK; // explicit unlock
 
-            SWSS_LOG_DEBUG("End of Flex_Counter cycle [%s], nothing to collect, enable %d empty %d m_pollInterval %d", m_instanceId.c_str(), m_enable, allIdsEmpty(), m_pollInterval);
+            SWSS_LOG_DEBUG("End of Flex_Counter cycle [%s], nothing to collect, enable %d empty %d m_pollInterval %d", m_instanceId.c_str(), m_enable.load(), allIdsEmpty(), m_pollInterval);
             // nothing to collect, wait until notified
             std::unique_lock<std::mutex> lk(m_mtxSleep);
             m_pollCond.wait(lk); // wait on mutex
@@ -312,12 +541,31 @@ void FlexCounter::removeCounter(
 
     SWSS_LOG_ENTER();
 
+    m_counterConfigs.erase(vid);
+
+    Collector *bulk = NULL;
+    Collector *priority = NULL;
+
+    PRIORITY_MUTEX;
+
     auto it = m_collectors.find(vid);
     if (it != m_collectors.end())
     {
-        delete it->second;
+        bulk = it->second;
         m_collectors.erase(it);
     }
+
+    it = m_priorityCollectors.find(vid);
+    if (it != m_priorityCollectors.end())
+    {
+        priority = it->second;
+        m_priorityCollectors.erase(it);
+    }
+
+    PRIORITY_MUTEX_UNLOCK;
+
+    delete bulk;
+    delete priority;
 }
 
 void FlexCounter::addCounter(
@@ -331,40 +579,409 @@ void FlexCounter::addCounter(
 
     otai_object_type_t objectType = VidManager::objectTypeQuery(vid); // VID and RID will have the same object type
 
+    CounterConfig config;
+
+    config.m_objectType = objectType;
+    config.m_rid = rid;
+
+    auto existing = m_counterConfigs.find(vid);
+
+    if (existing != m_counterConfigs.end())
+    {
+        config = existing->second;
+    }
+
+    bool hasCounterIds = false;
+    bool thresholdsChanged = false;
+
     for (const auto& valuePair : values)
     {
         const auto field = fvField(valuePair);
 
         const auto value = fvValue(valuePair);
-        auto idStrings = swss::tokenize(value, ',');
 
-        std::set<std::string> counterIds(idStrings.begin(), idStrings.end()); 
+        if (field.find(THRESHOLD_FIELD_PREFIX) == 0)
+        {
+            thresholdsChanged |= updateThreshold(field, value, config.m_thresholds);
+
+            continue;
+        }
+
+        auto idStrings = swss::tokenize(value, ',');
 
         SWSS_LOG_NOTICE("Object type %s rid 0x%" PRIx64 " m_propGroup %d",
                         otai_serialize_object_type(objectType).c_str(), rid, (int)m_propGroup);
-        
-        Collector *c = NULL;
 
-        if (m_propGroup == OTAI_PROPERTY_GROUP_ATTR)
+        config.m_counterIds = std::set<std::string>(idStrings.begin(), idStrings.end());
+
+        hasCounterIds = true;
+    }
+
+    if (hasCounterIds)
+    {
+        m_counterConfigs[vid] = config;
+
+        installCollectors(vid);
+    }
+    else if (thresholdsChanged && existing != m_counterConfigs.end())
+    {
+        existing->second.m_thresholds = config.m_thresholds;
+
+        if (m_propGroup == OTAI_PROPERTY_GROUP_GAUGE)
         {
-            c = new OtaiAttrCollector(objectType, vid, rid, m_vendorOtai, counterIds);
+            PRIORITY_MUTEX;
+
+            auto thresholds = getThresholds(vid);
+
+            if (m_collectors.count(vid))
+            {
+                static_cast<OtaiGaugeCollector*>(m_collectors.at(vid))->setThresholds(thresholds);
+            }
+
+            if (m_priorityCollectors.count(vid))
+            {
+                static_cast<OtaiGaugeCollector*>(m_priorityCollectors.at(vid))->setThresholds(thresholds);
+            }
         }
-        else if (m_propGroup == OTAI_PROPERTY_GROUP_STAT)
+    }
+
+    // notify threads to start polling
+    m_pollCond.notify_all();
+    notifyPriorityThread();
+}
+
+bool FlexCounter::isHighPriority(
+    _In_ otai_object_id_t vid,
+    _In_ const std::string& counterId) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_highPriorityObjects.find(vid) != m_highPriorityObjects.end() ||
+           m_highPriorityStatIds.find(counterId) != m_highPriorityStatIds.end();
+}
+
+void FlexCounter::installCollectors(
+    _In_ otai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    // must be called with m_mtx held
+
+    auto& config = m_counterConfigs.at(vid);
+
+    Collector *bulk = NULL;
+    Collector *priority = NULL;
+
+    if (m_propGroup == OTAI_PROPERTY_GROUP_ATTR)
+    {
+        bulk = new OtaiAttrCollector(config.m_objectType, vid, config.m_rid, m_vendorOtai, config.m_counterIds);
+    }
+    else if (m_propGroup == OTAI_PROPERTY_GROUP_STAT)
+    {
+        bulk = new OtaiStatCollector(config.m_objectType, vid, config.m_rid, m_vendorOtai, config.m_counterIds,
+                                     m_rateWindows);
+    }
+    else if (m_propGroup == OTAI_PROPERTY_GROUP_GAUGE)
+    {
+        std::set<std::string> bulkIds;
+        std::set<std::string> priorityIds;
+
+        for (auto& id: config.m_counterIds)
         {
-            c = new OtaiStatCollector(objectType, vid, rid, m_vendorOtai, counterIds);
+            if (isHighPriority(vid, id))
+            {
+                priorityIds.insert(id);
+            }
+            else
+            {
+                bulkIds.insert(id);
+            }
         }
-        else if (m_propGroup == OTAI_PROPERTY_GROUP_GAUGE)
+
+        auto thresholds = getThresholds(vid);
+
+        if (!bulkIds.empty())
         {
-            c = new OtaiGaugeCollector(objectType, vid, rid, m_vendorOtai, counterIds);
+            bulk = new OtaiGaugeCollector(config.m_objectType, vid, config.m_rid, m_vendorOtai, bulkIds,
+                                          thresholds, m_thresholdReporter);
         }
 
-        if (c != NULL)
+        if (!priorityIds.empty())
         {
-            m_collectors[vid] = c;
+            SWSS_LOG_NOTICE("Object 0x%" PRIx64 " has %zu high priority gauges on instance %s",
+                            vid, priorityIds.size(), m_instanceId.c_str());
+
+            priority = new OtaiGaugeCollector(config.m_objectType, vid, config.m_rid, m_vendorOtai, priorityIds,
+                                              thresholds, m_thresholdReporter);
         }
     }
 
-    // notify thread to start polling
-    m_pollCond.notify_all();
+    // collectors are built outside of the priority lock, so creating them
+    // (which probes vendor stats support) does not stall the priority lane,
+    // old collectors are destroyed under the lock before new ones are
+    // installed, so their cleanup can't race with new collector writes
+
+    Collector *oldBulk = NULL;
+    Collector *oldPriority = NULL;
+
+    PRIORITY_MUTEX;
+
+    auto it = m_collectors.find(vid);
+    if (it != m_collectors.end())
+    {
+        oldBulk = it->second;
+        m_collectors.erase(it);
+    }
+
+    it = m_priorityCollectors.find(vid);
+    if (it != m_priorityCollectors.end())
+    {
+        oldPriority = it->second;
+        m_priorityCollectors.erase(it);
+    }
+
+    if (m_propGroup == OTAI_PROPERTY_GROUP_GAUGE)
+    {
+        // gauges moved between lanes keep their PM bins and raised alarms
+
+        for (auto newCollector: { bulk, priority })
+        {
+            for (auto oldCollector: { oldBulk, oldPriority })
+            {
+                if (newCollector != NULL && oldCollector != NULL)
+                {
+                    static_cast<OtaiGaugeCollector*>(newCollector)->adoptState(
+                            *static_cast<OtaiGaugeCollector*>(oldCollector));
+                }
+            }
+        }
+    }
+
+    delete oldBulk;
+    delete oldPriority;
+
+    if (bulk != NULL)
+    {
+        bulk->setChangeFeed(m_changeFeedEnabled ? m_bulkChangeFeed : nullptr);
+
+        m_collectors[vid] = bulk;
+    }
+
+    if (priority != NULL)
+    {
+        priority->setChangeFeed(m_changeFeedEnabled ? m_priorityChangeFeed : nullptr);
+
+        m_priorityCollectors[vid] = priority;
+    }
+
+    PRIORITY_MUTEX_UNLOCK;
+}
+
+OtaiGaugeCollector::threshold_map_t FlexCounter::getThresholds(
+    _In_ otai_object_id_t vid) const
+{
+    SWSS_LOG_ENTER();
+
+    auto thresholds = m_thresholds;
+
+    auto it = m_counterConfigs.find(vid);
+
+    if (it != m_counterConfigs.end())
+    {
+        for (auto& kv: it->second.m_thresholds)
+        {
+            thresholds[kv.first] = kv.second;
+        }
+    }
+
+    return thresholds;
+}
+
+bool FlexCounter::updateThreshold(
+    _In_ const std::string& field,
+    _In_ const std::string& value,
+    _Inout_ OtaiGaugeCollector::threshold_map_t& thresholds)
+{
+    SWSS_LOG_ENTER();
+
+    std::string statId = field.substr(strlen(THRESHOLD_FIELD_PREFIX));
+
+    if (value.empty())
+    {
+        return thresholds.erase(statId) > 0;
+    }
+
+    OtaiGaugeCollector::Threshold threshold;
+
+    if (!OtaiGaugeCollector::parseThreshold(value, threshold))
+    {
+        SWSS_LOG_ERROR("Ignoring threshold %s on instance %s", field.c_str(), m_instanceId.c_str());
+
+        return false;
+    }
+
+    auto it = thresholds.find(statId);
+
+    if (it != thresholds.end() && it->second == threshold)
+    {
+        return false;
+    }
+
+    thresholds[statId] = threshold;
+
+    return true;
+}
+
+void FlexCounter::updateLaneStatistics(
+    _In_ const std::string& lane,
+    _Inout_ LaneStatistics& stats,
+    _In_ uint32_t delay,
+    _In_ uint32_t interval,
+    _In_ bool warnOnOverrun,
+    _In_ swss::Table& laneStatsTable)
+{
+    SWSS_LOG_ENTER();
+
+    stats.m_cycles++;
+    stats.m_lastCycleMs = delay;
+
+    if (delay > stats.m_maxCycleMs)
+    {
+        stats.m_maxCycleMs = delay;
+    }
+
+    if (delay > interval)
+    {
+        stats.m_overruns++;
+
+        if (warnOnOverrun)
+        {
+            SWSS_LOG_WARN("Flex_Counter %s lane [%s] cycle took %u ms, exceeds interval %u ms (overruns %" PRIu64 ")",
+                          lane.c_str(), m_instanceId.c_str(), delay, interval, stats.m_overruns);
+        }
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (now - stats.m_lastPublish < std::chrono::milliseconds(LANE_STATS_PUBLISH_INTERVAL_MS))
+    {
+        return;
+    }
+
+    stats.m_lastPublish = now;
+
+    std::vector<swss::FieldValueTuple> fvs;
+
+    fvs.emplace_back("interval", std::to_string(interval));
+    fvs.emplace_back("cycles", std::to_string(stats.m_cycles));
+    fvs.emplace_back("last-cycle-ms", std::to_string(stats.m_lastCycleMs));
+    fvs.emplace_back("max-cycle-ms", std::to_string(stats.m_maxCycleMs));
+    fvs.emplace_back("overruns", std::to_string(stats.m_overruns));
+
+    laneStatsTable.set(m_instanceId + ":" + lane, fvs);
+}
+
+void FlexCounter::priorityThreadRunFunction()
+{
+    SWSS_LOG_ENTER();
+
+    swss::DBConnector db(m_dbCounters, 0);
+    swss::Table laneStatsTable(&db, FLEX_COUNTER_LANE_STATS_TABLE);
+
+    while (m_runPriorityThread)
+    {
+        PRIORITY_MUTEX;
+
+        if (m_enable && !m_priorityCollectors.empty() && (m_priorityPollInterval > 0))
+        {
+            auto start = std::chrono::steady_clock::now();
+
+            for (auto &c : m_priorityCollectors)
+            {
+                c.second->collect();
+            }
+
+            auto finish = std::chrono::steady_clock::now();
+
+            m_priorityChangeFeed->publish();
+
+            uint32_t delay = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(finish - start).count());
+
+            uint32_t interval = m_priorityPollInterval;
+            uint32_t correction = delay % interval;
+            correction = interval - correction;
+            PRIORITY_MUTEX_UNLOCK; // explicit unlock
+
+            SWSS_LOG_DEBUG("End of Flex_Counter high priority cycle [%s], took %d ms / interval %d ms", m_instanceId.c_str(), delay, interval);
+
+            updateLaneStatistics(HIGH_PRIORITY_LANE, m_priorityLaneStats, delay, interval, true, laneStatsTable);
+
+            std::unique_lock<std::mutex> lk(m_priorityMtxSleep);
+            m_priorityCvSleep.wait_for(lk, std::chrono::milliseconds(correction), [&]{ return !m_runPriorityThread; });
+        }
+        else
+        {
+            PRIORITY_MUTEX_UNLOCK; // explicit unlock
+
+            // nothing to collect, wait until notified
+            std::unique_lock<std::mutex> lk(m_priorityMtxSleep);
+            m_priorityPollCond.wait(lk, [&]{ return !m_runPriorityThread || m_priorityPollNotified; });
+            m_priorityPollNotified = false;
+        }
+    }
+}
+
+void FlexCounter::notifyPriorityThread()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lk(m_priorityMtxSleep);
+
+    m_priorityPollNotified = true;
+
+    m_priorityPollCond.notify_all();
+}
+
+void FlexCounter::startPriorityThread()
+{
+    SWSS_LOG_ENTER();
+
+    m_runPriorityThread = true;
+
+    m_priorityThread = std::make_shared<std::thread>(&FlexCounter::priorityThreadRunFunction, this);
+
+    SWSS_LOG_NOTICE("Flex_Counter high priority thread started.");
 }
 
+void FlexCounter::endPriorityThread(void)
+{
+    SWSS_LOG_ENTER();
+
+    PRIORITY_MUTEX;
+
+    if (m_runPriorityThread)
+    {
+        {
+            std::lock_guard<std::mutex> lk(m_priorityMtxSleep);
+
+            m_runPriorityThread = false;
+
+            m_priorityPollCond.notify_all();
+
+            m_priorityCvSleep.notify_all();
+        }
+
+        if (m_priorityThread != nullptr)
+        {
+            auto fcThread = std::move(m_priorityThread);
+
+            PRIORITY_MUTEX_UNLOCK; // NOTE: explicit unlock before join to not cause deadlock
+
+            SWSS_LOG_NOTICE("Wait for Flex_Counter high priority thread to end");
+
+            fcThread->join();
+        }
+
+        SWSS_LOG_NOTICE("Flex_Counter high priority thread ended");
+    }
+}
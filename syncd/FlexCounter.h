@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <set>
 #include <condition_variable>
@@ -7,6 +8,8 @@
 #include <memory>
 #include <string>
 #include <mutex>
+#include <chrono>
+#include <thread>
 
 extern "C" {
 #include "otai.h"
@@ -14,6 +17,8 @@ extern "C" {
 
 #include "meta/OtaiInterface.h"
 
+#include "NotificationHandler.h"
+
 #include "swss/table.h"
 
 #include "pm/Collector.h"
@@ -23,6 +28,39 @@ extern "C" {
 
 using namespace std;
 
+/*
+ * Gauge group fields selecting the high priority lane. Stat ids and objects
+ * listed here are polled by a dedicated thread at their own interval, so a
+ * long bulk gauge cycle never delays them.
+ */
+#define HIGH_PRIORITY_STAT_IDS_FIELD        "HIGH_PRIORITY_STAT_IDS"
+#define HIGH_PRIORITY_OBJECTS_FIELD         "HIGH_PRIORITY_OBJECTS"
+#define HIGH_PRIORITY_POLL_INTERVAL_FIELD   "HIGH_PRIORITY_POLL_INTERVAL"
+
+#define HIGH_PRIORITY_DEFAULT_POLL_INTERVAL (200)
+
+#define FLEX_COUNTER_LANE_STATS_TABLE       "FLEX_COUNTER_LANE_STATS"
+
+/*
+ * Gauge threshold field, "THRESHOLD:<stat id>" with value
+ * "low,high[,hysteresis[,severity]]". Set on the group it applies to all
+ * objects, set on a counter it overrides the group value for that object.
+ * Empty value removes the threshold.
+ */
+#define THRESHOLD_FIELD_PREFIX              "THRESHOLD:"
+
+/*
+ * Group field enabling per cycle change feed, "enable" or "disable".
+ */
+#define CHANGE_FEED_FIELD                   "CHANGE_FEED"
+
+/*
+ * Counter group field, comma separated EWMA windows in seconds of per second
+ * rates, empty value disables rates.
+ */
+#define RATE_WINDOWS_FIELD                  "RATE_WINDOWS"
+#define DEFAULT_RATE_WINDOWS                "1,10,60"
+
 namespace syncd
 {
     enum otai_property_group_t
@@ -45,7 +83,8 @@ namespace syncd
         FlexCounter(
             _In_ const std::string& instanceId,
             _In_ std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
-            _In_ const std::string& dbCounters);
+            _In_ const std::string& dbCounters,
+            _In_ std::shared_ptr<NotificationHandler> handler);
 
         virtual ~FlexCounter();
 
@@ -79,6 +118,15 @@ namespace syncd
         void setStatsMode(
             _In_ const std::string& mode);
 
+        void setChangeFeed(
+            _In_ const std::string& status);
+
+        void setRateWindows(
+            _In_ const std::string& windows);
+
+        void setPriorityPollInterval(
+            _In_ const std::string& interval);
+
     private:
 
         void checkPluginRegistered(
@@ -88,6 +136,55 @@ namespace syncd
 
         bool allPluginsEmpty() const;
 
+    private:
+
+        struct CounterConfig
+        {
+            otai_object_type_t m_objectType;
+
+            otai_object_id_t m_rid;
+
+            std::set<std::string> m_counterIds;
+
+            OtaiGaugeCollector::threshold_map_t m_thresholds;
+        };
+
+        struct LaneStatistics
+        {
+            uint64_t m_cycles = 0;
+
+            uint32_t m_lastCycleMs = 0;
+
+            uint32_t m_maxCycleMs = 0;
+
+            uint64_t m_overruns = 0;
+
+            std::chrono::steady_clock::time_point m_lastPublish;
+        };
+
+        bool isHighPriority(
+            _In_ otai_object_id_t vid,
+            _In_ const std::string& counterId) const;
+
+        void installCollectors(
+            _In_ otai_object_id_t vid);
+
+        OtaiGaugeCollector::threshold_map_t getThresholds(
+            _In_ otai_object_id_t vid) const;
+
+        bool updateThreshold(
+            _In_ const std::string& field,
+            _In_ const std::string& value,
+            _Inout_ OtaiGaugeCollector::threshold_map_t& thresholds);
+
+        void updateLaneStatistics(
+            _In_ const std::string& lane,
+            _Inout_ LaneStatistics& stats,
+            _In_ uint32_t delay,
+            _In_ uint32_t interval,
+            _In_ bool warnOnOverrun,
+            _In_ swss::Table& laneStatsTable);
+
     private:
 
         void collectCounters();
@@ -100,6 +197,18 @@ namespace syncd
 
         void flexCounterThreadRunFunction();
 
+        void startPriorityThread();
+
+        void endPriorityThread();
+
+        void priorityThreadRunFunction();
+
+        /*
+         * Wake priority thread waiting for configuration, wakeup is kept
+         * until thread consumes it, so it can't be lost.
+         */
+        void notifyPriorityThread();
+
     private:
 
         typedef void (FlexCounter::* collect_counters_handler_t)(
@@ -136,7 +245,9 @@ namespace syncd
 
         otai_stats_mode_t m_statsMode;
 
-        bool m_enable;
+        // read by priority thread without m_mtx
+
+        std::atomic<bool> m_enable;
 
         collect_counters_handler_unordered_map_t m_collectCountersHandlers;
 
@@ -147,6 +258,63 @@ namespace syncd
         bool m_isDiscarded;
 
         otai_property_group_t m_propGroup;
+
+        std::string m_dbCounters;
+
+        std::map<otai_object_id_t, CounterConfig> m_counterConfigs;
+
+        std::shared_ptr<NotificationHandler> m_handler;
+
+        OtaiGaugeCollector::threshold_map_t m_thresholds;
+
+        OtaiGaugeCollector::threshold_reporter_t m_thresholdReporter;
+
+        LaneStatistics m_bulkLaneStats;
+
+        bool m_changeFeedEnabled;
+
+        std::vector<uint32_t> m_rateWindows;
+
+        std::shared_ptr<ChangeFeed> m_bulkChangeFeed;
+
+    private: // high priority lane
+
+        /*
+         * Members below are modified while holding both m_mtx and
+         * m_priorityMtx (always in that order), so the priority thread only
+         * needs m_priorityMtx to read them.
+         */
+
+        /*
+         * Written under m_priorityMtxSleep, so predicate waits of priority
+         * thread can't miss stop, atomic for checks without the lock.
+         */
+        std::atomic<bool> m_runPriorityThread;
+
+        std::shared_ptr<std::thread> m_priorityThread;
+
+        std::mutex m_priorityMtxSleep;
+
+        // guarded by m_priorityMtxSleep
+        bool m_priorityPollNotified;
+
+        std::condition_variable m_priorityCvSleep;
+
+        std::mutex m_priorityMtx;
+
+        std::condition_variable m_priorityPollCond;
+
+        uint32_t m_priorityPollInterval;
+
+        std::set<std::string> m_highPriorityStatIds;
+
+        std::set<otai_object_id_t> m_highPriorityObjects;
+
+        map<otai_object_id_t, Collector*> m_priorityCollectors;
+
+        LaneStatistics m_priorityLaneStats;
+
+        std::shared_ptr<ChangeFeed> m_priorityChangeFeed;
     };
 }
 
@@ -8,9 +8,11 @@ using namespace syncd;
 
 FlexCounterManager::FlexCounterManager(
     _In_ std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
-    _In_ const std::string& dbCounters):
+    _In_ const std::string& dbCounters,
+    _In_ std::shared_ptr<NotificationHandler> handler):
     m_vendorOtai(vendorOtai),
-    m_dbCounters(dbCounters)
+    m_dbCounters(dbCounters),
+    m_handler(handler)
 {
     SWSS_LOG_ENTER();
 
@@ -26,7 +28,7 @@ std::shared_ptr<FlexCounter> FlexCounterManager::getInstance(
 
     if (m_flexCounters.count(instanceId) == 0)
     {
-        auto counter = std::make_shared<FlexCounter>(instanceId, m_vendorOtai, m_dbCounters);
+        auto counter = std::make_shared<FlexCounter>(instanceId, m_vendorOtai, m_dbCounters, m_handler);
 
         m_flexCounters[instanceId] = counter;
     }
@@ -10,7 +10,8 @@ namespace syncd
 
         FlexCounterManager(
             _In_ std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
-            _In_ const std::string& dbCounters);
+            _In_ const std::string& dbCounters,
+            _In_ std::shared_ptr<NotificationHandler> handler);
 
         virtual ~FlexCounterManager() = default;
 
@@ -50,6 +51,8 @@ namespace syncd
         std::shared_ptr<otairedis::OtaiInterface> m_vendorOtai;
 
         std::string m_dbCounters;
+
+        std::shared_ptr<NotificationHandler> m_handler;
         std::string m_dbState;
         std::string m_dbGBCounters;
     };
@@ -0,0 +1,287 @@
+#include "LatencyStatistics.h"
+
+#include "meta/otai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace syncd;
+
+#define LATENCY_HISTOGRAM_SUB_BUCKETS (1ULL << LATENCY_HISTOGRAM_SUB_BUCKET_BITS)
+
+LatencyHistogram::LatencyHistogram()
+{
+    SWSS_LOG_ENTER();
+
+    reset();
+}
+
+size_t LatencyHistogram::getBucketIndex(
+        _In_ uint64_t us)
+{
+    SWSS_LOG_ENTER();
+
+    if (us > UINT32_MAX)
+    {
+        us = UINT32_MAX;
+    }
+
+    if (us < LATENCY_HISTOGRAM_SUB_BUCKETS)
+    {
+        return (size_t)us;
+    }
+
+    // position of highest bit selects power of two range, next bits select
+    // linear bucket inside that range
+
+    int msb = 63 - __builtin_clzll(us);
+
+    int shift = msb - LATENCY_HISTOGRAM_SUB_BUCKET_BITS;
+
+    return ((size_t)(shift + 1) << LATENCY_HISTOGRAM_SUB_BUCKET_BITS) + ((us >> shift) & (LATENCY_HISTOGRAM_SUB_BUCKETS - 1));
+}
+
+uint64_t LatencyHistogram::getBucketUpperBound(
+        _In_ size_t index)
+{
+    SWSS_LOG_ENTER();
+
+    if (index < LATENCY_HISTOGRAM_SUB_BUCKETS)
+    {
+        return index;
+    }
+
+    int shift = (int)(index >> LATENCY_HISTOGRAM_SUB_BUCKET_BITS) - 1;
+
+    uint64_t sub = index & (LATENCY_HISTOGRAM_SUB_BUCKETS - 1);
+
+    return ((LATENCY_HISTOGRAM_SUB_BUCKETS + sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(
+        _In_ uint64_t us)
+{
+    SWSS_LOG_ENTER();
+
+    m_buckets[getBucketIndex(us)].fetch_add(1, std::memory_order_relaxed);
+
+    m_count.fetch_add(1, std::memory_order_relaxed);
+
+    m_total.fetch_add(us, std::memory_order_relaxed);
+
+    uint64_t max = m_max.load(std::memory_order_relaxed);
+
+    while (us > max && !m_max.compare_exchange_weak(max, us, std::memory_order_relaxed))
+    {
+        // max was reloaded, retry
+    }
+}
+
+void LatencyHistogram::reset()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& bucket: m_buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+
+    m_count.store(0, std::memory_order_relaxed);
+    m_total.store(0, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getTotal() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_total.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getMax() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_max.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getPercentile(
+        _In_ double percentile) const
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t count = getCount();
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank = (uint64_t)std::ceil(percentile * (double)count);
+
+    rank = std::max<uint64_t>(rank, 1);
+
+    uint64_t cumulative = 0;
+
+    for (size_t index = 0; index < LATENCY_HISTOGRAM_BUCKETS; index++)
+    {
+        cumulative += m_buckets[index].load(std::memory_order_relaxed);
+
+        if (cumulative >= rank)
+        {
+            return std::min(getBucketUpperBound(index), getMax());
+        }
+    }
+
+    // buckets and count are updated separately, reader may see them apart
+
+    return getMax();
+}
+
+LatencyStatistics::LatencyStatistics(
+        _In_ const std::string& keyPrefix):
+    m_entries(OTAI_COMMON_API_MAX * OTAI_OBJECT_TYPE_MAX),
+    m_keyPrefix(keyPrefix)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& entry: m_entries)
+    {
+        entry.store(nullptr);
+    }
+}
+
+LatencyStatistics::~LatencyStatistics()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& entry: m_entries)
+    {
+        delete entry.load();
+    }
+}
+
+LatencyStatistics::Entry* LatencyStatistics::getEntry(
+        _In_ otai_common_api_t api,
+        _In_ otai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    if (api < 0 || api >= OTAI_COMMON_API_MAX || objectType < 0 || objectType >= OTAI_OBJECT_TYPE_MAX)
+    {
+        return nullptr;
+    }
+
+    auto& slot = m_entries[api * OTAI_OBJECT_TYPE_MAX + objectType];
+
+    Entry* entry = slot.load(std::memory_order_acquire);
+
+    if (entry)
+    {
+        return entry;
+    }
+
+    Entry* created = new Entry();
+
+    if (slot.compare_exchange_strong(entry, created, std::memory_order_acq_rel))
+    {
+        return created;
+    }
+
+    // other thread installed entry first
+
+    delete created;
+
+    return entry;
+}
+
+LatencyStatistics::time_point_t LatencyStatistics::record(
+        _In_ otai_common_api_t api,
+        _In_ otai_object_type_t objectType,
+        _In_ latency_stage_t stage,
+        _In_ time_point_t start)
+{
+    SWSS_LOG_ENTER();
+
+    auto now = std::chrono::steady_clock::now();
+
+    Entry* entry = getEntry(api, objectType);
+
+    if (entry && stage < LATENCY_STAGE_MAX)
+    {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(now - start).count();
+
+        entry->m_stages[stage].record((uint64_t)us);
+    }
+
+    return now;
+}
+
+void LatencyStatistics::reset()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& slot: m_entries)
+    {
+        Entry* entry = slot.load(std::memory_order_acquire);
+
+        if (entry == nullptr)
+        {
+            continue;
+        }
+
+        for (auto& histogram: entry->m_stages)
+        {
+            histogram.reset();
+        }
+    }
+}
+
+void LatencyStatistics::publish(
+        _In_ swss::Table& table) const
+{
+    SWSS_LOG_ENTER();
+
+    static const char* names[LATENCY_STAGE_MAX] = { "deserialize", "translate", "vendor", "response", "asic-db" };
+
+    for (size_t index = 0; index < m_entries.size(); index++)
+    {
+        Entry* entry = m_entries[index].load(std::memory_order_acquire);
+
+        if (entry == nullptr)
+        {
+            continue;
+        }
+
+        auto api = (otai_common_api_t)(index / OTAI_OBJECT_TYPE_MAX);
+        auto objectType = (otai_object_type_t)(index % OTAI_OBJECT_TYPE_MAX);
+
+        std::vector<swss::FieldValueTuple> values;
+
+        for (int stage = 0; stage < LATENCY_STAGE_MAX; stage++)
+        {
+            auto& histogram = entry->m_stages[stage];
+
+            uint64_t count = histogram.getCount();
+
+            std::string name = names[stage];
+
+            values.emplace_back(name + "-count", std::to_string(count));
+            values.emplace_back(name + "-avg-us", std::to_string(count ? histogram.getTotal() / count : 0));
+            values.emplace_back(name + "-p50-us", std::to_string(histogram.getPercentile(0.50)));
+            values.emplace_back(name + "-p99-us", std::to_string(histogram.getPercentile(0.99)));
+            values.emplace_back(name + "-max-us", std::to_string(histogram.getMax()));
+        }
+
+        table.set(m_keyPrefix + otai_serialize_common_api(api) + ":" + otai_serialize_object_type(objectType), values);
+    }
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+extern "C" {
+#include "otai.h"
+}
+
+#include "swss/table.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * Per operation latency histograms in STATE_DB, keyed by common api and
+ * object type, refreshed by main loop and cleared by "reset" op on latency
+ * stats notification channel.
+ */
+#define LATENCY_STATS_TABLE "SYNCD_LATENCY_STATS"
+
+/*
+ * Bulk requests are recorded once per request, under keys with this prefix,
+ * so they don't skew single object latencies.
+ */
+#define LATENCY_STATS_BULK_KEY_PREFIX "BULK:"
+
+#define LATENCY_STATS_INTERVAL_MS (10000)
+
+#define SYNCD_NOTIFICATION_CHANNEL_LATENCY_STATS "LATENCYSTATS"
+
+#define LATENCY_STATS_OP_RESET "reset"
+
+/*
+ * Each power of two range is split into 4 linear buckets, so reported
+ * percentile is within 25% of actual value. Values above 2^32 us are
+ * counted in last bucket.
+ */
+#define LATENCY_HISTOGRAM_SUB_BUCKET_BITS (2)
+
+#define LATENCY_HISTOGRAM_BUCKETS (128)
+
+namespace syncd
+{
+    typedef enum _latency_stage_t
+    {
+        LATENCY_STAGE_DESERIALIZE,
+
+        LATENCY_STAGE_TRANSLATE,
+
+        LATENCY_STAGE_VENDOR,
+
+        LATENCY_STAGE_RESPONSE,
+
+        LATENCY_STAGE_ASIC_DB,
+
+        LATENCY_STAGE_MAX,
+
+    } latency_stage_t;
+
+    /**
+     * @brief Log-linear histogram of latencies in microseconds.
+     *
+     * Counters are relaxed atomics, recording is lock free and histogram
+     * can be read while it's updated.
+     */
+    class LatencyHistogram
+    {
+        public:
+
+            LatencyHistogram();
+
+            virtual ~LatencyHistogram() = default;
+
+        public:
+
+            void record(
+                    _In_ uint64_t us);
+
+            void reset();
+
+            uint64_t getCount() const;
+
+            uint64_t getTotal() const;
+
+            uint64_t getMax() const;
+
+            /**
+             * @brief Get upper bound of bucket holding given percentile.
+             */
+            uint64_t getPercentile(
+                    _In_ double percentile) const;
+
+        private:
+
+            static size_t getBucketIndex(
+                    _In_ uint64_t us);
+
+            static uint64_t getBucketUpperBound(
+                    _In_ size_t index);
+
+        private:
+
+            std::atomic<uint64_t> m_buckets[LATENCY_HISTOGRAM_BUCKETS];
+
+            std::atomic<uint64_t> m_count;
+
+            std::atomic<uint64_t> m_total;
+
+            std::atomic<uint64_t> m_max;
+    };
+
+    /**
+     * @brief Latency histograms of processing stages per (api, object type).
+     *
+     * Histograms are allocated on first use, slots are atomic pointers so
+     * recording takes no lock.
+     */
+    class LatencyStatistics
+    {
+        public:
+
+            typedef std::chrono::steady_clock::time_point time_point_t;
+
+        public:
+
+            LatencyStatistics(
+                    _In_ const std::string& keyPrefix = "");
+
+            virtual ~LatencyStatistics();
+
+        public:
+
+            /**
+             * @brief Record time elapsed since start for given stage.
+             *
+             * @return Current time, start of next stage.
+             */
+            time_point_t record(
+                    _In_ otai_common_api_t api,
+                    _In_ otai_object_type_t objectType,
+                    _In_ latency_stage_t stage,
+                    _In_ time_point_t start);
+
+            void reset();
+
+            /**
+             * @brief Write all used histograms to table.
+             */
+            void publish(
+                    _In_ swss::Table& table) const;
+
+        private:
+
+            struct Entry
+            {
+                LatencyHistogram m_stages[LATENCY_STAGE_MAX];
+            };
+
+            LatencyStatistics(const LatencyStatistics&) = delete;
+            LatencyStatistics& operator=(const LatencyStatistics&) = delete;
+
+            Entry* getEntry(
+                    _In_ otai_common_api_t api,
+                    _In_ otai_object_type_t objectType);
+
+        private:
+
+            std::vector<std::atomic<Entry*>> m_entries;
+
+            std::string m_keyPrefix;
+    };
+}
@@ -21,7 +21,6 @@ NotificationHandler::NotificationHandler(
     memset(&m_notifications, 0, sizeof(m_notifications));
     m_state_db = std::shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
     m_linecardtable = std::unique_ptr<Table>(new Table(m_state_db.get(), "LINECARD"));
-    m_curalarmtable = std::unique_ptr<Table>(new Table(m_state_db.get(), "CURALARM"));
     m_notificationQueue = processor->getQueue();
 }
 
@@ -117,13 +116,11 @@ void NotificationHandler::onOcmReportSpectrumPower(
         return;
     }
 
-    nlohmann::json j;
-    j["linecard_rid"] = otai_serialize_object_id(linecard_rid);
-    j["ocm_id"] = otai_serialize_object_id(ocm_id);
-    j["spectrum_power_list"] = otai_serialize_ocm_spectrum_power_list(ocm_result);
+    std::unique_ptr<NotificationItem> item(new OcmSpectrumPowerNotificationItem(linecard_rid, ocm_id, ocm_result));
 
-    std::string s = j.dump();
-    enqueueNotification(OTAI_OCM_NOTIFICATION_NAME_SPECTRUM_POWER_NOTIFY, s);
+    // newer scan of the same OCM replaces the one still waiting in queue
+    enqueueCoalescedNotification(std::string(OTAI_OCM_NOTIFICATION_NAME_SPECTRUM_POWER_NOTIFY) + ":" + otai_serialize_object_id(ocm_id),
+                                 std::move(item));
 }
 
 void NotificationHandler::onOtdrReportResult(
@@ -133,26 +130,9 @@ void NotificationHandler::onOtdrReportResult(
 {
     SWSS_LOG_ENTER();
 
-    nlohmann::json j;
-
-    j["linecard_rid"] = otai_serialize_object_id(linecard_rid);
-    j["otdr_id"] = otai_serialize_object_id(otdr_id);
-
-    j["scan-time"] = otai_serialize_number(result.scanning_profile.scan_time);
-    j["distance-range"] = otai_serialize_number(result.scanning_profile.distance_range);
-    j["pulse-width"] = otai_serialize_number(result.scanning_profile.pulse_width);
-    j["average-time"] = otai_serialize_number(result.scanning_profile.average_time);
-    j["output-frequency"] = otai_serialize_number(result.scanning_profile.output_frequency);
-
-    j["span-distance"] = otai_serialize_decimal(result.events.span_distance);
-    j["span-loss"] = otai_serialize_decimal(result.events.span_loss);
-    j["events"] = otai_serialize_otdr_event_list(result.events.events);
+    std::unique_ptr<NotificationItem> item(new OtdrResultNotificationItem(linecard_rid, otdr_id, result));
 
-    j["update-time"] = otai_serialize_number(result.trace.update_time);
-    j["data"] = otai_serialize_hex_binary(result.trace.data.list, result.trace.data.count);
-
-    std::string s = j.dump();
-    enqueueNotification(OTAI_OTDR_NOTIFICATION_NAME_RESULT_NOTIFY, s);
+    enqueueNotification(std::move(item));
 }
 
 void NotificationHandler::updateNotificationsPointers(
@@ -257,6 +237,16 @@ void NotificationHandler::onLinecardStateChange(
 
     enqueueNotification(OTAI_LINECARD_NOTIFICATION_NAME_LINECARD_STATE_CHANGE, s);
 
+    if (linecard_oper_status == OTAI_OPER_STATUS_INACTIVE)
+    {
+        // clear all current alarms, queued ahead of communication alarm so
+        // it's processed in order with alarms already in queue
+
+        auto now = (uint64_t)chrono::duration_cast<chrono::nanoseconds>(chrono::system_clock::now().time_since_epoch()).count();
+
+        enqueueNotification(SYNCD_NOTIFICATION_NAME_CLEAR_ACTIVE_ALARMS, otai_serialize_number(now));
+    }
+
     generate_linecard_communication_alarm(linecard_rid, linecard_oper_status);
 }
 
@@ -289,9 +279,6 @@ void NotificationHandler::generate_linecard_communication_alarm(
         {
             status = OTAI_ALARM_STATUS_ACTIVE;
             m_linecardtable->hset(strlinecard, "slot-status", "CommFail");
-
-            //flush all current alarms
-            m_curalarmtable->flush();
         }
         else
         {
@@ -341,6 +328,31 @@ void NotificationHandler::onLinecardAlarm(
     enqueueNotification(OTAI_LINECARD_NOTIFICATION_NAME_LINECARD_ALARM_NOTIFY, s);
 }
 
+void NotificationHandler::onThresholdCrossing(
+    _In_ otai_object_id_t resource_rid,
+    _In_ const std::string& type_id,
+    _In_ const std::string& severity,
+    _In_ const std::string& text,
+    _In_ uint64_t time_created,
+    _In_ bool active)
+{
+    SWSS_LOG_ENTER();
+
+    nlohmann::json j;
+
+    otai_alarm_status_t status = active ? OTAI_ALARM_STATUS_ACTIVE : OTAI_ALARM_STATUS_INACTIVE;
+
+    j["time-created"] = otai_serialize_number(time_created);
+    j["resource_oid"] = otai_serialize_object_id(resource_rid);
+    j["text"] = text;
+    j["severity"] = severity;
+    j["type-id"] = type_id;
+    j["status"] = otai_serialize_enum(status, &otai_metadata_enum_otai_alarm_status_t);
+
+    std::string s = j.dump();
+    enqueueNotification(SYNCD_NOTIFICATION_NAME_THRESHOLD_CROSSING, s);
+}
+
 void NotificationHandler::enqueueNotification(
     _In_ const std::string& op,
     _In_ const std::string& data,
@@ -350,9 +362,36 @@ void NotificationHandler::enqueueNotification(
 
     SWSS_LOG_INFO("%s %s", op.c_str(), data.c_str());
 
-    swss::KeyOpFieldsValuesTuple item(op, data, entry);
+    std::unique_ptr<NotificationItem> item(new SerializedNotificationItem(op, data, entry));
+
+    if (m_notificationQueue->enqueue(std::move(item)))
+    {
+        m_processor->signal();
+    }
+}
+
+void NotificationHandler::enqueueNotification(
+    _In_ std::unique_ptr<NotificationItem> item)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_INFO("%s", item->getName().c_str());
+
+    if (m_notificationQueue->enqueue(std::move(item)))
+    {
+        m_processor->signal();
+    }
+}
+
+void NotificationHandler::enqueueCoalescedNotification(
+    _In_ const std::string& coalesceKey,
+    _In_ std::unique_ptr<NotificationItem> item)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_INFO("%s %s", item->getName().c_str(), coalesceKey.c_str());
 
-    if (m_notificationQueue->enqueue(item))
+    if (m_notificationQueue->enqueueCoalesced(coalesceKey, std::move(item)))
     {
         m_processor->signal();
     }
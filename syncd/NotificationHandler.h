@@ -63,6 +63,16 @@ namespace syncd
             _In_ otai_object_id_t otdr_id,
             _In_ otai_otdr_result_t otdr_result);
 
+    public: // syncd internal notifications
+
+        void onThresholdCrossing(
+            _In_ otai_object_id_t resource_rid,
+            _In_ const std::string& type_id,
+            _In_ const std::string& severity,
+            _In_ const std::string& text,
+            _In_ uint64_t time_created,
+            _In_ bool active);
+
     private:
 
         void generate_linecard_communication_alarm(
@@ -78,14 +88,19 @@ namespace syncd
             _In_ const std::string& op,
             _In_ const std::string& data);
 
+        void enqueueNotification(
+            _In_ std::unique_ptr<NotificationItem> item);
+
+        void enqueueCoalescedNotification(
+            _In_ const std::string& coalesceKey,
+            _In_ std::unique_ptr<NotificationItem> item);
+
     private:
 
         std::shared_ptr<swss::DBConnector> m_state_db;
 
         std::unique_ptr<swss::Table> m_linecardtable;
 
-        std::unique_ptr<swss::Table> m_curalarmtable;
-
         otai_notifications_t m_notifications;
 
         std::shared_ptr<NotificationQueue> m_notificationQueue;
@@ -0,0 +1,148 @@
+#include "NotificationItem.h"
+#include "otairediscommon.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+NotificationItem::NotificationItem(
+        _In_ const std::string& name,
+        _In_ notification_priority_t priority):
+    m_name(name),
+    m_priority(priority)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+NotificationItem::~NotificationItem()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+const std::string& NotificationItem::getName() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_name;
+}
+
+notification_priority_t NotificationItem::getPriority() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_priority;
+}
+
+void NotificationItem::setEnqueueTime(
+        _In_ std::chrono::steady_clock::time_point time)
+{
+    SWSS_LOG_ENTER();
+
+    m_enqueueTime = time;
+}
+
+std::chrono::steady_clock::time_point NotificationItem::getEnqueueTime() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_enqueueTime;
+}
+
+SerializedNotificationItem::SerializedNotificationItem(
+        _In_ const std::string& name,
+        _In_ const std::string& data,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ notification_priority_t priority):
+    NotificationItem(name, priority),
+    m_data(data),
+    m_values(values)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+SerializedNotificationItem::~SerializedNotificationItem()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+const std::string& SerializedNotificationItem::getData() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_data;
+}
+
+const std::vector<swss::FieldValueTuple>& SerializedNotificationItem::getValues() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_values;
+}
+
+OcmSpectrumPowerNotificationItem::OcmSpectrumPowerNotificationItem(
+        _In_ otai_object_id_t linecardRid,
+        _In_ otai_object_id_t ocmRid,
+        _In_ const otai_spectrum_power_list_t& list):
+    NotificationItem(OTAI_OCM_NOTIFICATION_NAME_SPECTRUM_POWER_NOTIFY, NOTIFICATION_PRIORITY_BULK),
+    m_linecardRid(linecardRid),
+    m_ocmRid(ocmRid)
+{
+    SWSS_LOG_ENTER();
+
+    if (list.list)
+    {
+        m_spectrum.assign(list.list, list.list + list.count);
+    }
+}
+
+OcmSpectrumPowerNotificationItem::~OcmSpectrumPowerNotificationItem()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+OtdrResultNotificationItem::OtdrResultNotificationItem(
+        _In_ otai_object_id_t linecardRid,
+        _In_ otai_object_id_t otdrRid,
+        _In_ const otai_otdr_result_t& result):
+    NotificationItem(OTAI_OTDR_NOTIFICATION_NAME_RESULT_NOTIFY, NOTIFICATION_PRIORITY_BULK),
+    m_linecardRid(linecardRid),
+    m_otdrRid(otdrRid),
+    m_result(result)
+{
+    SWSS_LOG_ENTER();
+
+    if (result.events.events.list)
+    {
+        m_events.assign(result.events.events.list, result.events.events.list + result.events.events.count);
+    }
+
+    if (result.trace.data.list)
+    {
+        m_data.assign(result.trace.data.list, result.trace.data.list + result.trace.data.count);
+    }
+
+    // vendor buffers are not valid after callback returns
+
+    m_result.events.events.count = 0;
+    m_result.events.events.list = NULL;
+
+    m_result.trace.data.count = 0;
+    m_result.trace.data.list = NULL;
+}
+
+OtdrResultNotificationItem::~OtdrResultNotificationItem()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
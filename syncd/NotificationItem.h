@@ -0,0 +1,159 @@
+#pragma once
+
+extern "C" {
+#include <otai.h>
+}
+
+#include "swss/table.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Notification priority class.
+     *
+     * Control notifications (linecard state, alarms, protection switch) are
+     * drained ahead of bulk telemetry (OCM spectrum, OTDR trace).
+     */
+    typedef enum _notification_priority_t
+    {
+        NOTIFICATION_PRIORITY_CONTROL,
+
+        NOTIFICATION_PRIORITY_BULK,
+
+        NOTIFICATION_PRIORITY_MAX,
+
+    } notification_priority_t;
+
+    /**
+     * @brief Notification passed from OTAI callback to processing thread.
+     *
+     * Item is created once in callback context and moved through the
+     * notification queue, payload is serialized only when it leaves syncd.
+     */
+    class NotificationItem
+    {
+        public:
+
+            NotificationItem(
+                    _In_ const std::string& name,
+                    _In_ notification_priority_t priority = NOTIFICATION_PRIORITY_CONTROL);
+
+            virtual ~NotificationItem();
+
+        public:
+
+            const std::string& getName() const;
+
+            notification_priority_t getPriority() const;
+
+            /**
+             * @brief Set by notification queue when item is enqueued, used
+             * to measure time spent waiting in queue.
+             */
+            void setEnqueueTime(
+                    _In_ std::chrono::steady_clock::time_point time);
+
+            std::chrono::steady_clock::time_point getEnqueueTime() const;
+
+        private:
+
+            NotificationItem(const NotificationItem&) = delete;
+            NotificationItem& operator=(const NotificationItem&) = delete;
+
+            std::string m_name;
+
+            notification_priority_t m_priority;
+
+            std::chrono::steady_clock::time_point m_enqueueTime;
+    };
+
+    /**
+     * @brief Notification carrying serialized data.
+     *
+     * Used for small notifications like alarms and linecard state, which are
+     * stored and forwarded in serialized form anyway.
+     */
+    class SerializedNotificationItem:
+        public NotificationItem
+    {
+        public:
+
+            SerializedNotificationItem(
+                    _In_ const std::string& name,
+                    _In_ const std::string& data,
+                    _In_ const std::vector<swss::FieldValueTuple>& values = {},
+                    _In_ notification_priority_t priority = NOTIFICATION_PRIORITY_CONTROL);
+
+            virtual ~SerializedNotificationItem();
+
+        public:
+
+            const std::string& getData() const;
+
+            const std::vector<swss::FieldValueTuple>& getValues() const;
+
+        private:
+
+            std::string m_data;
+
+            std::vector<swss::FieldValueTuple> m_values;
+    };
+
+    /**
+     * @brief OCM spectrum power scan, list is copied out of vendor buffer.
+     */
+    class OcmSpectrumPowerNotificationItem:
+        public NotificationItem
+    {
+        public:
+
+            OcmSpectrumPowerNotificationItem(
+                    _In_ otai_object_id_t linecardRid,
+                    _In_ otai_object_id_t ocmRid,
+                    _In_ const otai_spectrum_power_list_t& list);
+
+            virtual ~OcmSpectrumPowerNotificationItem();
+
+        public:
+
+            otai_object_id_t m_linecardRid;
+
+            otai_object_id_t m_ocmRid;
+
+            std::vector<otai_spectrum_power_t> m_spectrum;
+    };
+
+    /**
+     * @brief OTDR scan result, event list and trace data are copied out of
+     * vendor buffers, list pointers in m_result are cleared.
+     */
+    class OtdrResultNotificationItem:
+        public NotificationItem
+    {
+        public:
+
+            OtdrResultNotificationItem(
+                    _In_ otai_object_id_t linecardRid,
+                    _In_ otai_object_id_t otdrRid,
+                    _In_ const otai_otdr_result_t& result);
+
+            virtual ~OtdrResultNotificationItem();
+
+        public:
+
+            otai_object_id_t m_linecardRid;
+
+            otai_object_id_t m_otdrRid;
+
+            otai_otdr_result_t m_result;
+
+            std::vector<otai_otdr_event_t> m_events;
+
+            std::vector<uint8_t> m_data;
+    };
+}
@@ -1,11 +1,13 @@
 #include "NotificationProcessor.h"
 #include "RedisClient.h"
+#include "CommandLineOptions.h"
 
 #include "meta/otai_serialize.h"
 #include "meta/OtaiAttributeList.h"
 
 #include "swss/logger.h"
 #include "swss/notificationproducer.h"
+#include "swss/redisreply.h"
 
 #include "nlohmann/json.hpp"
 #include <inttypes.h>
@@ -18,10 +20,66 @@ using namespace swss;
 #define EXIPRE_TIME_SECONDS_2DAYS (2 * 24 * 3600)
 #define EXIPRE_TIME_SECONDS_7DAYS (7 * 24 * 3600)
 
+static void pipelineCommand(
+        _In_ RedisPipeline& pipeline,
+        _In_ const std::vector<std::string>& args,
+        _In_ int expectedType)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<const char*> argv;
+    std::vector<size_t> argvlen;
+
+    for (auto& arg: args)
+    {
+        argv.push_back(arg.c_str());
+        argvlen.push_back(arg.size());
+    }
+
+    RedisCommand command;
+
+    command.formatArgv((int)argv.size(), argv.data(), argvlen.data());
+
+    pipeline.push(command, expectedType);
+}
+
+static std::vector<std::string> arrayCommand(
+        _In_ DBConnector& db,
+        _In_ const std::vector<std::string>& args)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<const char*> argv;
+    std::vector<size_t> argvlen;
+
+    for (auto& arg: args)
+    {
+        argv.push_back(arg.c_str());
+        argvlen.push_back(arg.size());
+    }
+
+    RedisCommand command;
+
+    command.formatArgv((int)argv.size(), argv.data(), argvlen.data());
+
+    RedisReply r(&db, command, REDIS_REPLY_ARRAY);
+
+    auto ctx = r.getContext();
+
+    std::vector<std::string> elements;
+
+    for (size_t i = 0; i < ctx->elements; i++)
+    {
+        elements.push_back(std::string(ctx->element[i]->str, ctx->element[i]->len));
+    }
+
+    return elements;
+}
+
 NotificationProcessor::NotificationProcessor(
     _In_ std::shared_ptr<NotificationProducerBase> producer,
     _In_ std::shared_ptr<RedisClient> client,
-    _In_ std::function<void(const swss::KeyOpFieldsValuesTuple&)> synchronizer) :
+    _In_ std::function<void(const NotificationItem&)> synchronizer) :
     m_synchronizer(synchronizer),
     m_client(client),
     m_notifications(producer)
@@ -29,12 +87,18 @@ NotificationProcessor::NotificationProcessor(
     SWSS_LOG_ENTER();
 
     m_runThread = false;
+    m_batchWrites = false;
 
     m_notificationQueue = std::make_shared<NotificationQueue>();
     m_state_db = std::shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
+    m_counters_db = std::shared_ptr<DBConnector>(new DBConnector("COUNTERS_DB", 0));
     m_stateAlarmable = std::unique_ptr<Table>(new Table(m_state_db.get(), "CURALARM"));
     m_stateOLPSwitchInfoTbl = std::unique_ptr<Table>(new Table(m_state_db.get(), "OLP_SWITCH_INFO"));
+    m_stateQueueStatsTable = std::unique_ptr<Table>(new Table(m_state_db.get(), NOTIFICATION_QUEUE_STATS_TABLE));
     m_stateOcmTable = std::unique_ptr<Table>(new Table(m_state_db.get(), STATE_OT_OCM_TABLE_NAME));
+    m_stateOcmSpectrumTable = std::unique_ptr<Table>(new Table(m_state_db.get(), STATE_OCM_SPECTRUM_POWER_TABLE_NAME));
+    m_statePipeline = std::make_shared<RedisPipeline>(m_state_db.get());
+    m_ocmPacked = false;
 
     m_stateOtdrTable = std::make_shared<Table>(m_state_db.get(), STATE_OT_OTDR_TABLE_NAME);
     m_stateOtdrEventTable = std::make_shared<Table>(m_state_db.get(), "OTDR_EVENT");
@@ -45,8 +109,13 @@ NotificationProcessor::NotificationProcessor(
 
     m_historyOtdrTable = std::make_shared<Table>(m_history_db.get(), "OTDR");
     m_historyOtdrEventTable = std::make_shared<Table>(m_history_db.get(), "OTDR_EVENT");
+    m_historyPipeline = std::make_shared<RedisPipeline>(m_history_db.get());
+
+    initOtdrScanIndex();
 
-    initOtdrScanTimeSet();
+    m_alarmPipeline = std::make_shared<RedisPipeline>(m_state_db.get());
+
+    initActiveAlarms();
 
     m_ttlPM15Min = EXIPRE_TIME_SECONDS_2DAYS;
     m_ttlPM24Hour = EXIPRE_TIME_SECONDS_7DAYS;
@@ -60,15 +129,24 @@ NotificationProcessor::~NotificationProcessor()
     stopNotificationsProcessingThread();
 }
 
-void NotificationProcessor::initOtdrScanTimeSet()
+void NotificationProcessor::migrateOtdrScanIndex()
 {
     SWSS_LOG_ENTER();
 
-    std::map<std::string, std::set<uint64_t>> scanTimeSet;
+    /*
+     * History written before scan index was introduced is not indexed, scan
+     * it once, index every entry and mark database as migrated so further
+     * startups never need KEYS on HISTORY_DB.
+     */
+
+    if (m_history_db->get(OTDR_HISTORY_INDEX_VERSION) != nullptr)
+    {
+        return;
+    }
 
-    std::string pattern = "OTDR:*";
+    auto keys = m_history_db->keys(m_historyOtdrTable->getKeyName("*"));
 
-    auto keys = m_history_db->keys(pattern);
+    size_t count = keys.size();
 
     for (auto &k : keys)
     {
@@ -80,21 +158,165 @@ void NotificationProcessor::initOtdrScanTimeSet()
             continue;
         }
 
-        uint64_t scanTime = 0;
-        otai_deserialize_number(*strScanTime, scanTime);
+        pipelineCommand(*m_historyPipeline, { "ZADD", OTDR_HISTORY_INDEX_PREFIX + *name, *strScanTime, k }, REDIS_REPLY_INTEGER);
+        pipelineCommand(*m_historyPipeline, { "SADD", OTDR_HISTORY_INDEX_NAMES, *name }, REDIS_REPLY_INTEGER);
+    }
+
+    keys = m_history_db->keys(m_historyOtdrEventTable->getKeyName("*"));
+
+    count += keys.size();
 
-        scanTimeSet[*name].insert(scanTime);
+    std::string prefix = m_historyOtdrEventTable->getKeyName("");
+
+    for (auto &k : keys)
+    {
+        /*
+         * Event key is <name>|<scan-time>|<index>.
+         */
+
+        std::string key = k.substr(prefix.size());
+
+        auto indexPos = key.rfind('|');
+
+        if (indexPos == std::string::npos || indexPos == 0)
+        {
+            continue;
+        }
+
+        auto scanPos = key.rfind('|', indexPos - 1);
+
+        if (scanPos == std::string::npos)
+        {
+            continue;
+        }
+
+        std::string name = key.substr(0, scanPos);
+        std::string strScanTime = key.substr(scanPos + 1, indexPos - scanPos - 1);
+
+        pipelineCommand(*m_historyPipeline, { "ZADD", OTDR_HISTORY_INDEX_PREFIX + name, strScanTime, k }, REDIS_REPLY_INTEGER);
     }
 
-    for (auto &s : scanTimeSet)
+    m_historyPipeline->flush();
+
+    m_history_db->set(OTDR_HISTORY_INDEX_VERSION, "1");
+
+    SWSS_LOG_NOTICE("migrated %zu otdr history keys to scan index", count);
+}
+
+void NotificationProcessor::initOtdrScanIndex()
+{
+    SWSS_LOG_ENTER();
+
+    migrateOtdrScanIndex();
+
+    auto names = arrayCommand(*m_history_db, { "SMEMBERS", OTDR_HISTORY_INDEX_NAMES });
+
+    for (auto &name : names)
     {
-        for (auto &t : s.second)
+        auto members = arrayCommand(*m_history_db, { "ZRANGE", OTDR_HISTORY_INDEX_PREFIX + name, "0", "-1" });
+
+        for (auto &m : members)
         {
-            m_otdrScanTimeQueue[s.first].push(t);
+            uint64_t scanTime;
+
+            if (getOtdrScanTime(name, m, scanTime))
+            {
+                m_otdrScanTimes[name].insert(scanTime);
+            }
         }
+
+        trimOtdrHistory(name);
     }
 }
 
+bool NotificationProcessor::getOtdrScanTime(
+    _In_ const std::string& name,
+    _In_ const std::string& member,
+    _Out_ uint64_t& scanTime)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Score is double and can't hold nanosecond scan time exactly, so it's
+     * used only for ordering, scan time is taken from member key, which is
+     * <table>|<name>|<scan-time> or <table>|<name>|<scan-time>|<index>.
+     */
+
+    for (auto &prefix : { m_historyOtdrTable->getKeyName(name + "|"), m_historyOtdrEventTable->getKeyName(name + "|") })
+    {
+        if (member.compare(0, prefix.size(), prefix) != 0)
+        {
+            continue;
+        }
+
+        std::string strScanTime = member.substr(prefix.size());
+
+        strScanTime = strScanTime.substr(0, strScanTime.find('|'));
+
+        try
+        {
+            otai_deserialize_number(strScanTime, scanTime);
+
+            return true;
+        }
+        catch (const std::exception&)
+        {
+            break;
+        }
+    }
+
+    SWSS_LOG_WARN("invalid otdr index member %s of %s", member.c_str(), name.c_str());
+
+    return false;
+}
+
+void NotificationProcessor::trimOtdrHistory(
+    _In_ const std::string& name)
+{
+    SWSS_LOG_ENTER();
+
+    auto& scanTimes = m_otdrScanTimes[name];
+
+    if (scanTimes.size() <= OTDR_HISTORY_MAX_SCANS)
+    {
+        return;
+    }
+
+    std::string index = OTDR_HISTORY_INDEX_PREFIX + name;
+
+    // index is read below, pending batched index updates must land first
+
+    m_historyPipeline->flush();
+
+    std::set<uint64_t> expired;
+
+    while (scanTimes.size() > OTDR_HISTORY_MAX_SCANS)
+    {
+        expired.insert(*scanTimes.begin());
+
+        scanTimes.erase(scanTimes.begin());
+    }
+
+    auto members = arrayCommand(*m_history_db, { "ZRANGE", index, "0", "-1" });
+
+    for (auto &m : members)
+    {
+        uint64_t scanTime;
+
+        if (!getOtdrScanTime(name, m, scanTime) || expired.find(scanTime) == expired.end())
+        {
+            continue;
+        }
+
+        SWSS_LOG_INFO("Delete old otdr data, %s", m.c_str());
+
+        pipelineCommand(*m_historyPipeline, { "DEL", m }, REDIS_REPLY_INTEGER);
+        pipelineCommand(*m_historyPipeline, { "ZREM", index, m }, REDIS_REPLY_INTEGER);
+    }
+
+    commitPipeline(*m_historyPipeline);
+}
+
 void NotificationProcessor::sendNotification(
     _In_ const std::string& op,
     _In_ const std::string& data,
@@ -172,9 +394,8 @@ void NotificationProcessor::handle_olp_switch_notify(
         SWSS_LOG_ERROR("translate rid to vid failed, rid=0x%" PRIx64, rid);
         return;
     }
-    auto counters_db = std::shared_ptr<swss::DBConnector>(new swss::DBConnector("COUNTERS_DB", 0));
     std::string strVid = otai_serialize_object_id(vid);
-    auto key = counters_db->hget(COUNTERS_OT_APS_NAME_MAP, strVid);
+    auto key = getResourceName(COUNTERS_OT_APS_NAME_MAP, vid);
     if (key == nullptr)
     {
         SWSS_LOG_ERROR("cannot get name map, %s %s", COUNTERS_OT_APS_NAME_MAP, strVid.c_str());
@@ -191,24 +412,16 @@ void NotificationProcessor::handle_olp_switch_notify(
 }
 
 void NotificationProcessor::handle_ocm_spectrum_power_notify(
-    _In_ const std::string& data,
-    _In_ const std::vector<FieldValueTuple>& fv)
+    _In_ const OcmSpectrumPowerNotificationItem& item)
 {
     SWSS_LOG_ENTER();
 
-    json j = json::parse(data);
-
     otai_object_id_t vid;
-    otai_object_id_t rid;
-    otai_spectrum_power_list_t list;
+    otai_object_id_t rid = item.m_ocmRid;
 
     otai_object_id_t linecard_vid;
-    otai_object_id_t linecard_rid;
 
-    otai_deserialize_object_id(j["ocm_id"], rid);
-    otai_deserialize_object_id(j["linecard_rid"], linecard_rid);
-    
-    otai_deserialize_ocm_spectrum_power_list(j["spectrum_power_list"], list);
+    auto& list = item.m_spectrum;
 
     if (!m_translator->tryTranslateRidToVid(rid, vid))
     {
@@ -216,30 +429,69 @@ void NotificationProcessor::handle_ocm_spectrum_power_notify(
         return;
     }
 
-    linecard_vid = m_translator->translateRidToVid(linecard_rid, OTAI_NULL_OBJECT_ID);
+    linecard_vid = m_translator->translateRidToVid(item.m_linecardRid, OTAI_NULL_OBJECT_ID);
 
-    auto counters_db = std::shared_ptr<swss::DBConnector>(new swss::DBConnector("COUNTERS_DB", 0));
     std::string strVid = otai_serialize_object_id(vid);
-    auto key = counters_db->hget(COUNTERS_OT_OCM_NAME_MAP, strVid);
+    auto key = getResourceName(COUNTERS_OT_OCM_NAME_MAP, vid);
     if (key == nullptr)
     {
         SWSS_LOG_ERROR("cannot get name map, %s %s", COUNTERS_OT_OCM_NAME_MAP, strVid.c_str());
         return;
     }
 
-    for (uint32_t i = 0 ; i < list.count; i++)
+    std::string strExpire = std::to_string(OCM_SPECTRUM_EXPIRE_TIME_SECONDS);
+
+    if (m_ocmPacked)
     {
-        std::string lowFreq = otai_serialize_number(list.list[i].lower_frequency);
-        std::string upFreq = otai_serialize_number(list.list[i].upper_frequency);
-        std::string power = otai_serialize_decimal(list.list[i].power);
+        /*
+         * Whole spectrum is built in temporary key and renamed over the
+         * previous one, so readers never see partial scan and channels
+         * missing in new scan disappear. Rename keeps TTL of new key.
+         */
+
+        std::string redisKey = m_stateOcmSpectrumTable->getKeyName(*key);
+        std::string tmpKey = redisKey + ":tmp";
 
-        std::string tableKey = *key + '|' + lowFreq + '|' + upFreq;
+        std::vector<std::string> hset = { "HSET", tmpKey };
 
-        m_stateOcmTable->hset(tableKey, "lower-frequency", lowFreq);
-        m_stateOcmTable->hset(tableKey, "upper-frequency", upFreq);
-        m_stateOcmTable->hset(tableKey, "power", power);
-        m_stateOcmTable->expire(tableKey, 60);  /* expire after 1 minute */
+        for (size_t i = 0 ; i < list.size(); i++)
+        {
+            hset.push_back(otai_serialize_number(list[i].lower_frequency) + '|' +
+                           otai_serialize_number(list[i].upper_frequency));
+            hset.push_back(otai_serialize_decimal(list[i].power));
+        }
+
+        if (list.empty())
+        {
+            pipelineCommand(*m_statePipeline, { "DEL", redisKey }, REDIS_REPLY_INTEGER);
+        }
+        else
+        {
+            pipelineCommand(*m_statePipeline, { "DEL", tmpKey }, REDIS_REPLY_INTEGER);
+            pipelineCommand(*m_statePipeline, hset, REDIS_REPLY_INTEGER);
+            pipelineCommand(*m_statePipeline, { "EXPIRE", tmpKey, strExpire }, REDIS_REPLY_INTEGER);
+            pipelineCommand(*m_statePipeline, { "RENAME", tmpKey, redisKey }, REDIS_REPLY_STATUS);
+        }
     }
+    else
+    {
+        for (size_t i = 0 ; i < list.size(); i++)
+        {
+            std::string lowFreq = otai_serialize_number(list[i].lower_frequency);
+            std::string upFreq = otai_serialize_number(list[i].upper_frequency);
+            std::string power = otai_serialize_decimal(list[i].power);
+
+            std::string redisKey = m_stateOcmTable->getKeyName(*key + '|' + lowFreq + '|' + upFreq);
+
+            pipelineCommand(*m_statePipeline,
+                    { "HSET", redisKey, "lower-frequency", lowFreq, "upper-frequency", upFreq, "power", power },
+                    REDIS_REPLY_INTEGER);
+
+            pipelineCommand(*m_statePipeline, { "EXPIRE", redisKey, strExpire }, REDIS_REPLY_INTEGER);
+        }
+    }
+
+    commitPipeline(*m_statePipeline);
 
     json j2;
 
@@ -249,54 +501,33 @@ void NotificationProcessor::handle_ocm_spectrum_power_notify(
     sendNotification(OTAI_OCM_NOTIFICATION_NAME_SPECTRUM_POWER_NOTIFY, j2.dump());
 }
 
-void writeOtdrTable(
-        std::shared_ptr<Table> table,
-        std::string &key,
-        std::string &name,
-        json &j)
-{
-    SWSS_LOG_ENTER();
-
-    table->hset(key, "name", name);
-    table->hset(key, "scan-time", j["scan-time"]);
-    table->hset(key, "distance-range", j["distance-range"]);
-    table->hset(key, "pulse-width", j["pulse-width"]);
-    table->hset(key, "average-time", j["average-time"]);
-    table->hset(key, "output-frequency", j["output-frequency"]);
-    table->hset(key, "span-distance", j["span-distance"]);
-    table->hset(key, "span-loss", j["span-loss"]);
-    table->hset(key, "update-time", j["update-time"]);
-    table->hset(key, "data", j["data"]);
-}
-
 void writeOtdrEventTable(
         std::shared_ptr<Table> table,
-        std::string &key,
-        otai_otdr_event_t &e,
+        const std::string &key,
+        const otai_otdr_event_t &e,
         uint32_t index)
 {
     SWSS_LOG_ENTER();
 
-    table->hset(key, "index", otai_serialize_number(index));
-    table->hset(key, "length", otai_serialize_decimal(e.length));
-    table->hset(key, "loss", otai_serialize_decimal(e.loss));
-    table->hset(key, "accumulate-loss", otai_serialize_decimal(e.accumulate_loss));
-    table->hset(key, "type", otai_serialize_enum(e.type, &otai_metadata_enum_otai_otdr_event_type_t));
-    table->hset(key, "reflection", otai_serialize_decimal(e.reflection));
+    std::vector<FieldValueTuple> values;
+
+    values.emplace_back("index", otai_serialize_number(index));
+    values.emplace_back("length", otai_serialize_decimal(e.length));
+    values.emplace_back("loss", otai_serialize_decimal(e.loss));
+    values.emplace_back("accumulate-loss", otai_serialize_decimal(e.accumulate_loss));
+    values.emplace_back("type", otai_serialize_enum(e.type, &otai_metadata_enum_otai_otdr_event_type_t));
+    values.emplace_back("reflection", otai_serialize_decimal(e.reflection));
+
+    table->set(key, values);
 }
 
 void NotificationProcessor::handle_otdr_result_notify(
-    _In_ const std::string& data,
-    _In_ const std::vector<FieldValueTuple>& fv)
+    _In_ const OtdrResultNotificationItem& item)
 {
     SWSS_LOG_ENTER();
 
     otai_object_id_t otdrVid;
-    otai_object_id_t otdrRid;
-
-    json j = json::parse(data);
-
-    otai_deserialize_object_id(j["otdr_id"], otdrRid);
+    otai_object_id_t otdrRid = item.m_otdrRid;
 
     if (!m_translator->tryTranslateRidToVid(otdrRid, otdrVid))
     {
@@ -304,11 +535,9 @@ void NotificationProcessor::handle_otdr_result_notify(
         return;
     }
 
-    auto counters_db = std::shared_ptr<swss::DBConnector>(new swss::DBConnector("COUNTERS_DB", 0));
-
     std::string strVid = otai_serialize_object_id(otdrVid);
 
-    auto key = counters_db->hget(COUNTERS_OT_OTDR_NAME_MAP, strVid);
+    auto key = getResourceName(COUNTERS_OT_OTDR_NAME_MAP, otdrVid);
 
     if (key == nullptr)
     {
@@ -316,68 +545,70 @@ void NotificationProcessor::handle_otdr_result_notify(
         return;
     }
 
-    std::string stateTableKey = *key + "|CURRENT";
+    auto& result = item.m_result;
+    auto& events = item.m_events;
+
+    std::string strScanTime = otai_serialize_number(result.scanning_profile.scan_time);
 
-    writeOtdrTable(m_stateOtdrTable, stateTableKey, *key, j);
+    // trace is serialized once and stored to both current and history table
 
-    otai_otdr_event_list_t events;
+    std::vector<FieldValueTuple> values;
 
-    otai_deserialize_otdr_event_list(j["events"], events);
+    values.emplace_back("name", *key);
+    values.emplace_back("scan-time", strScanTime);
+    values.emplace_back("distance-range", otai_serialize_number(result.scanning_profile.distance_range));
+    values.emplace_back("pulse-width", otai_serialize_number(result.scanning_profile.pulse_width));
+    values.emplace_back("average-time", otai_serialize_number(result.scanning_profile.average_time));
+    values.emplace_back("output-frequency", otai_serialize_number(result.scanning_profile.output_frequency));
+    values.emplace_back("span-distance", otai_serialize_decimal(result.events.span_distance));
+    values.emplace_back("span-loss", otai_serialize_decimal(result.events.span_loss));
+    values.emplace_back("update-time", otai_serialize_number(result.trace.update_time));
+    values.emplace_back("data", otai_serialize_hex_binary(item.m_data.data(), item.m_data.size()));
+
+    std::string stateTableKey = *key + "|CURRENT";
 
-    for (uint32_t i = 0; i < events.count; i++)
+    m_stateOtdrTable->set(stateTableKey, values);
+
+    for (uint32_t i = 0; i < events.size(); i++)
     {
         uint32_t index = i + 1;
 
         std::string eventKey = *key + "|CURRENT|" + otai_serialize_number(index);
 
-        writeOtdrEventTable(m_stateOtdrEventTable, eventKey, events.list[i], index);
+        writeOtdrEventTable(m_stateOtdrEventTable, eventKey, events[i], index);
     }
 
-    std::string strScanTime = j["scan-time"];
     std::string historyTableKey = *key + "|" + strScanTime;
 
-    writeOtdrTable(m_historyOtdrTable, historyTableKey, *key, j);
+    m_historyOtdrTable->set(historyTableKey, values);
 
-    for (uint32_t i = 0; i < events.count; i++)
+    for (uint32_t i = 0; i < events.size(); i++)
     {
         uint32_t index = i + 1;
 
         std::string eventKey = *key + "|" + strScanTime + "|" + otai_serialize_number(index);
 
-        writeOtdrEventTable(m_historyOtdrEventTable, eventKey, events.list[i], index);
+        writeOtdrEventTable(m_historyOtdrEventTable, eventKey, events[i], index);
     }
 
-    uint64_t scanTime = 0;
-
-    otai_deserialize_number(j["scan-time"], scanTime);
+    std::string index = OTDR_HISTORY_INDEX_PREFIX + *key;
 
-    m_otdrScanTimeQueue[*key].push(scanTime);
+    pipelineCommand(*m_historyPipeline, { "ZADD", index, strScanTime, m_historyOtdrTable->getKeyName(historyTableKey) }, REDIS_REPLY_INTEGER);
 
-    while (m_otdrScanTimeQueue[*key].size() > 10)
+    for (uint32_t i = 0; i < events.size(); i++)
     {
-        scanTime = m_otdrScanTimeQueue[*key].front(); 
-
-        m_otdrScanTimeQueue[*key].pop();
+        std::string eventKey = *key + "|" + strScanTime + "|" + otai_serialize_number(i + 1);
 
-        std::string entry = m_historyOtdrTable->getTableName() + ":" +
-                            *key + "|" + otai_serialize_number(scanTime);
-
-        SWSS_LOG_INFO("Delete old otdr data, %s", entry.c_str());
-
-        m_history_db->del(entry);
+        pipelineCommand(*m_historyPipeline, { "ZADD", index, strScanTime, m_historyOtdrEventTable->getKeyName(eventKey) }, REDIS_REPLY_INTEGER);
+    }
 
-        std::string pattern = m_historyOtdrEventTable->getTableName() + ":" +
-                              *key + "|" + otai_serialize_number(scanTime) + "*";
+    pipelineCommand(*m_historyPipeline, { "SADD", OTDR_HISTORY_INDEX_NAMES, *key }, REDIS_REPLY_INTEGER);
 
-        auto keys = m_history_db->keys(pattern);
+    commitPipeline(*m_historyPipeline);
 
-        for (auto &k : keys)
-        {
-            SWSS_LOG_INFO("Delete old otdr event data, %s", k.c_str());
+    m_otdrScanTimes[*key].insert(result.scanning_profile.scan_time);
 
-            m_history_db->del(k);
-        }
-    }
+    trimOtdrHistory(*key);
 }
 
 void NotificationProcessor::handle_linecard_alarm(
@@ -390,13 +621,42 @@ void NotificationProcessor::handle_linecard_alarm(
     otai_alarm_info_t alarm_info;
 
     otai_deserialize_linecard_alarm(data, linecard_id, alarm_type, alarm_info);
+
+    bool isAlarm = alarm_info.status == OTAI_ALARM_STATUS_ACTIVE || alarm_info.status == OTAI_ALARM_STATUS_INACTIVE;
+
+    uint32_t flapCount = 0;
+
+    if (isAlarm && m_alarmDamping)
+    {
+        json j = json::parse(data);
+
+        otai_object_id_t rid;
+        otai_deserialize_object_id(j["resource_oid"], rid);
+
+        std::string type_id = j["type-id"];
+        std::string keyid = get_resource_name_by_rid(rid) + "#" + type_id;
+
+        bool active = alarm_info.status == OTAI_ALARM_STATUS_ACTIVE;
+
+        if (!m_alarmDamping->update(keyid, type_id, active, data, std::chrono::steady_clock::now()))
+        {
+            SWSS_LOG_INFO("alarm %s %s held by damping", keyid.c_str(), active ? "raise" : "clear");
+            return;
+        }
+
+        if (!active)
+        {
+            flapCount = m_alarmDamping->takeFlapCount(keyid);
+        }
+    }
+
     if (alarm_info.status == OTAI_ALARM_STATUS_ACTIVE)
     {
         handler_alarm_generated(data);
     }
     else if (alarm_info.status == OTAI_ALARM_STATUS_INACTIVE)
     {
-        handler_alarm_cleared(data);
+        handler_alarm_cleared(data, flapCount);
     }
     else
     {
@@ -404,6 +664,40 @@ void NotificationProcessor::handle_linecard_alarm(
     }
 }
 
+void NotificationProcessor::handle_threshold_crossing(
+    _In_ const std::string& data)
+{
+    SWSS_LOG_ENTER();
+
+    json j = json::parse(data);
+
+    int32_t status;
+    otai_deserialize_enum(j["status"], &otai_metadata_enum_otai_alarm_status_t, status);
+
+    if (status == OTAI_ALARM_STATUS_ACTIVE)
+    {
+        handler_alarm_generated(data);
+
+        return;
+    }
+
+    // collector clears on its first sample without knowing if alarm was
+    // raised before restart, skip quietly what is not active
+
+    otai_object_id_t rid;
+    otai_deserialize_object_id(j["resource_oid"], rid);
+
+    std::string type_id = j["type-id"];
+    std::string keyid = get_resource_name_by_rid(rid) + "#" + type_id;
+
+    if (!isAlarmActive(keyid))
+    {
+        return;
+    }
+
+    handler_alarm_cleared(data);
+}
+
 std::string NotificationProcessor::get_resource_name_by_rid(
         _In_ otai_object_id_t rid)
 {
@@ -418,9 +712,7 @@ std::string NotificationProcessor::get_resource_name_by_rid(
         return "";
     }
 
-    auto counters_db = std::shared_ptr<swss::DBConnector>(new swss::DBConnector("COUNTERS_DB", 0));
-    std::string strVid = otai_serialize_object_id(vid);
-    auto key = counters_db->hget("VID2NAME", strVid);
+    auto key = getResourceName("VID2NAME", vid);
     if (key == NULL)
     {
         SWSS_LOG_ERROR("Failed to get name from VID2NAME, vid=0x%" PRIx64, vid);
@@ -431,6 +723,60 @@ std::string NotificationProcessor::get_resource_name_by_rid(
     return *key;
 }
 
+std::shared_ptr<std::string> NotificationProcessor::getResourceName(
+        _In_ const std::string& nameMap,
+        _In_ otai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_nameMutex);
+
+    auto& names = m_resourceNames[nameMap];
+
+    auto it = names.find(vid);
+
+    if (it != names.end())
+    {
+        return std::make_shared<std::string>(it->second);
+    }
+
+    /*
+     * Only hits are cached, name map is populated by object owner after
+     * object is created, so miss must be retried on next lookup.
+     */
+
+    auto name = m_counters_db->hget(nameMap, otai_serialize_object_id(vid));
+
+    if (name != nullptr)
+    {
+        names[vid] = *name;
+    }
+
+    return name;
+}
+
+void NotificationProcessor::invalidateResourceName(
+        _In_ otai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_nameMutex);
+
+    for (auto& names: m_resourceNames)
+    {
+        names.second.erase(vid);
+    }
+}
+
+void NotificationProcessor::clearResourceNames()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_nameMutex);
+
+    m_resourceNames.clear();
+}
+
 void NotificationProcessor::handler_event_generated(
     _In_ const std::string data)
 {
@@ -467,8 +813,21 @@ void NotificationProcessor::handler_event_generated(
     alarmVector.emplace_back(tupletemp);
 
     std::string strKey = keyid + "#" + timecreated;
-    m_historyEventTable->set(strKey, alarmVector);
-    m_historyEventTable->expire(strKey, m_ttlAlarm);
+    std::string redisKey = m_historyEventTable->getKeyName(strKey);
+
+    std::vector<std::string> hset = { "HSET", redisKey };
+
+    for (auto& fv: alarmVector)
+    {
+        hset.push_back(fvField(fv));
+        hset.push_back(fvValue(fv));
+    }
+
+    pipelineCommand(*m_historyPipeline, hset, REDIS_REPLY_INTEGER);
+    pipelineCommand(*m_historyPipeline, { "EXPIRE", redisKey, std::to_string(m_ttlAlarm) }, REDIS_REPLY_INTEGER);
+
+    commitPipeline(*m_historyPipeline);
+
     SWSS_LOG_WARN("EVENT generated key:%s content:%s", strKey.c_str(), data.c_str());
 }
 
@@ -478,9 +837,7 @@ void NotificationProcessor::handler_alarm_generated(
     SWSS_LOG_ENTER();
 
     std::vector<FieldValueTuple> alarmVector;
-    std::vector<FieldValueTuple> vectortemp;
 
-    bool alarmstatus;
     json j = json::parse(data);
     FieldValueTuple tupletemp;
     std::string keyid;
@@ -499,9 +856,9 @@ void NotificationProcessor::handler_alarm_generated(
     keyid = j["id"] = resource + "#" + type_id;
     j["time-created"] = timecreated;
 
-    alarmstatus = m_stateAlarmable->get(keyid, vectortemp);
+    std::lock_guard<std::mutex> lock(m_alarmMutex);
 
-    if (alarmstatus == true)
+    if (m_activeAlarms.find(keyid) != m_activeAlarms.end())
     {
         SWSS_LOG_NOTICE("alarm already generated(%s)", keyid.c_str());
         return;
@@ -515,7 +872,20 @@ void NotificationProcessor::handler_alarm_generated(
     tupletemp = std::make_pair("resource", resource);
     alarmVector.emplace_back(tupletemp);
 
-    m_stateAlarmable->set(keyid, alarmVector);
+    m_activeAlarms[keyid] = alarmVector;
+
+    std::vector<std::string> hset = { "HSET", m_stateAlarmable->getKeyName(keyid) };
+
+    for (auto& fv: alarmVector)
+    {
+        hset.push_back(fvField(fv));
+        hset.push_back(fvValue(fv));
+    }
+
+    pipelineCommand(*m_alarmPipeline, hset, REDIS_REPLY_INTEGER);
+
+    commitPipeline(*m_alarmPipeline);
+
     SWSS_LOG_WARN("ALARM generated key:%s content:%s", keyid.c_str(), data.c_str());
 }
 
@@ -524,19 +894,31 @@ void NotificationProcessor::handler_history_alarm(
     _In_ const std::string& timecreated,
     _In_ const std::vector<FieldValueTuple>& alarmvector)
 {
-    std::string strKey = key + "#" + timecreated;
-    m_historyAlarmTable->set(strKey, alarmvector);
-    m_historyAlarmTable->expire(strKey, m_ttlAlarm);
+    SWSS_LOG_ENTER();
+
+    std::string strKey = m_historyAlarmTable->getKeyName(key + "#" + timecreated);
+
+    std::vector<std::string> hset = { "HSET", strKey };
+
+    for (auto& fv: alarmvector)
+    {
+        hset.push_back(fvField(fv));
+        hset.push_back(fvValue(fv));
+    }
+
+    pipelineCommand(*m_historyPipeline, hset, REDIS_REPLY_INTEGER);
+    pipelineCommand(*m_historyPipeline, { "EXPIRE", strKey, std::to_string(m_ttlAlarm) }, REDIS_REPLY_INTEGER);
+
+    commitPipeline(*m_historyPipeline);
 }
 
 void NotificationProcessor::handler_alarm_cleared(
-    _In_ const std::string data)
+    _In_ const std::string data,
+    _In_ uint32_t flapCount)
 {
     SWSS_LOG_ENTER();
 
     std::string keyid;
-    bool alarmstatus;
-    std::vector<FieldValueTuple> vectortemp;
     std::string resource, type_id;
 
     json j = json::parse(data);
@@ -548,26 +930,150 @@ void NotificationProcessor::handler_alarm_cleared(
     type_id = j["type-id"];
 
     keyid = resource + "#" + type_id;
-    alarmstatus = m_stateAlarmable->get(keyid, vectortemp);
 
-    if (alarmstatus == false)
+    std::lock_guard<std::mutex> lock(m_alarmMutex);
+
+    auto it = m_activeAlarms.find(keyid);
+
+    if (it == m_activeAlarms.end())
     {
-        SWSS_LOG_WARN("alarm already cleared(%s)", keyid.c_str());
-        return;
+        if (flapCount == 0)
+        {
+            SWSS_LOG_WARN("alarm already cleared(%s)", keyid.c_str());
+            return;
+        }
+
+        // burst which started and ended while alarm was not reported, still
+        // leave one summarized history entry with its flap count
+
+        std::vector<FieldValueTuple> vectortemp;
+
+        j["id"] = keyid;
+
+        std::string data_array[] = { "id","time-created","text","severity","type-id" };
+
+        for (uint32_t i = 0; i < sizeof(data_array) / sizeof(data_array[0]); i++)
+        {
+            vectortemp.emplace_back(data_array[i], j[data_array[i]]);
+        }
+
+        vectortemp.emplace_back("resource", resource);
+
+        std::string time_cleared = j["time-created"];
+
+        vectortemp.emplace_back("time-cleared", time_cleared);
+        vectortemp.emplace_back("flap-count", otai_serialize_number(flapCount));
+
+        handler_history_alarm(keyid, time_cleared, vectortemp);
+
+        SWSS_LOG_NOTICE("ALARM burst key:%s flaps:%u content:%s", keyid.c_str(), flapCount, data.c_str());
     }
     else
     {
         std::string time_cleared = j["time-created"];//the attribute "time-created" is actually the time of alarm cleared.
-        FieldValueTuple tupletemp = std::make_pair("time-cleared", time_cleared);
-        vectortemp.push_back(tupletemp);
-        handler_history_alarm(keyid, time_cleared, vectortemp);
-        m_stateAlarmable->del(keyid);
+
+        clearActiveAlarm(keyid, time_cleared, flapCount);
+
         SWSS_LOG_WARN("ALARM cleared key:%s content:%s", keyid.c_str(), data.c_str());
     }
 }
 
+void NotificationProcessor::clearActiveAlarm(
+    _In_ const std::string& keyid,
+    _In_ const std::string& timeCleared,
+    _In_ uint32_t flapCount)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_activeAlarms.find(keyid);
+
+    if (it == m_activeAlarms.end())
+    {
+        return;
+    }
+
+    std::vector<FieldValueTuple> vectortemp = std::move(it->second);
+    m_activeAlarms.erase(it);
+
+    vectortemp.emplace_back("time-cleared", timeCleared);
+
+    if (flapCount)
+    {
+        vectortemp.emplace_back("flap-count", otai_serialize_number(flapCount));
+    }
+
+    handler_history_alarm(keyid, timeCleared, vectortemp);
+
+    pipelineCommand(*m_alarmPipeline, { "DEL", m_stateAlarmable->getKeyName(keyid) }, REDIS_REPLY_INTEGER);
+
+    commitPipeline(*m_alarmPipeline);
+}
+
+void NotificationProcessor::handle_clear_active_alarms(
+    _In_ const std::string& data)
+{
+    SWSS_LOG_ENTER();
+
+    // alarms raised before communication loss are stale, damping state of
+    // them too
+
+    if (m_alarmDamping)
+    {
+        m_alarmDamping->reset();
+    }
+
+    std::lock_guard<std::mutex> lock(m_alarmMutex);
+
+    std::vector<std::string> keys;
+
+    for (auto& alarm: m_activeAlarms)
+    {
+        keys.push_back(alarm.first);
+    }
+
+    for (auto& keyid: keys)
+    {
+        clearActiveAlarm(keyid, data, 0);
+    }
+
+    SWSS_LOG_WARN("ALARM cleared %zu active alarms on linecard communication loss", keys.size());
+}
+
+void NotificationProcessor::initActiveAlarms()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_alarmMutex);
+
+    std::vector<std::string> keys;
+
+    m_stateAlarmable->getKeys(keys);
+
+    for (auto& key: keys)
+    {
+        std::vector<FieldValueTuple> values;
+
+        if (m_stateAlarmable->get(key, values))
+        {
+            m_activeAlarms[key] = values;
+        }
+    }
+
+    SWSS_LOG_NOTICE("restored %zu active alarms", m_activeAlarms.size());
+}
+
+bool NotificationProcessor::isAlarmActive(
+    _In_ const std::string& keyid)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_alarmMutex);
+
+    return m_activeAlarms.find(keyid) != m_activeAlarms.end();
+}
+
 void NotificationProcessor::processNotification(
-    _In_ const swss::KeyOpFieldsValuesTuple& item)
+    _In_ const NotificationItem& item)
 {
     SWSS_LOG_ENTER();
 
@@ -575,13 +1081,37 @@ void NotificationProcessor::processNotification(
 }
 
 void NotificationProcessor::syncProcessNotification(
-    _In_ const swss::KeyOpFieldsValuesTuple& item)
+    _In_ const NotificationItem& item)
 {
     SWSS_LOG_ENTER();
 
-    std::string notification = kfvKey(item);
-    std::string data = kfvOp(item);
-    std::vector<FieldValueTuple> fv = kfvFieldsValues(item);
+    auto ocm = dynamic_cast<const OcmSpectrumPowerNotificationItem*>(&item);
+
+    if (ocm)
+    {
+        handle_ocm_spectrum_power_notify(*ocm);
+        return;
+    }
+
+    auto otdr = dynamic_cast<const OtdrResultNotificationItem*>(&item);
+
+    if (otdr)
+    {
+        handle_otdr_result_notify(*otdr);
+        return;
+    }
+
+    auto serialized = dynamic_cast<const SerializedNotificationItem*>(&item);
+
+    if (serialized == nullptr)
+    {
+        SWSS_LOG_ERROR("unknown notification item: %s", item.getName().c_str());
+        return;
+    }
+
+    const std::string& notification = serialized->getName();
+    const std::string& data = serialized->getData();
+    const std::vector<FieldValueTuple>& fv = serialized->getValues();
 
     if (notification == OTAI_LINECARD_NOTIFICATION_NAME_LINECARD_STATE_CHANGE)
     {
@@ -591,17 +1121,17 @@ void NotificationProcessor::syncProcessNotification(
     {
         handle_linecard_alarm(data);
     }
-    else if (notification == OTAI_APS_NOTIFICATION_NAME_OLP_SWITCH_NOTIFY)
+    else if (notification == SYNCD_NOTIFICATION_NAME_THRESHOLD_CROSSING)
     {
-        handle_olp_switch_notify(data, fv);
+        handle_threshold_crossing(data);
     }
-    else if (notification == OTAI_OCM_NOTIFICATION_NAME_SPECTRUM_POWER_NOTIFY)
+    else if (notification == SYNCD_NOTIFICATION_NAME_CLEAR_ACTIVE_ALARMS)
     {
-        handle_ocm_spectrum_power_notify(data, fv);
+        handle_clear_active_alarms(data);
     }
-    else if (notification == OTAI_OTDR_NOTIFICATION_NAME_RESULT_NOTIFY)
+    else if (notification == OTAI_APS_NOTIFICATION_NAME_OLP_SWITCH_NOTIFY)
     {
-        handle_otdr_result_notify(data, fv);
+        handle_olp_switch_notify(data, fv);
     }
     else
     {
@@ -609,29 +1139,202 @@ void NotificationProcessor::syncProcessNotification(
     }
 }
 
+void NotificationProcessor::commitPipeline(
+    _In_ RedisPipeline& pipeline)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_batchWrites)
+    {
+        pipeline.flush();
+    }
+}
+
+void NotificationProcessor::flushPipelines()
+{
+    SWSS_LOG_ENTER();
+
+    m_statePipeline->flush();
+    m_historyPipeline->flush();
+
+    std::lock_guard<std::mutex> lock(m_alarmMutex);
+
+    m_alarmPipeline->flush();
+}
+
+void NotificationProcessor::processAlarmDamping()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_alarmDamping)
+    {
+        return;
+    }
+
+    std::vector<AlarmDamping::Settled> settled;
+
+    m_alarmDamping->expire(std::chrono::steady_clock::now(), settled);
+
+    for (auto& alarm: settled)
+    {
+        // CURALARM is updated only when settled state differs from it, but
+        // every burst which settles cleared gets history entry with its
+        // flap count, also when alarm was not reported during the burst
+
+        bool reported = isAlarmActive(alarm.m_key);
+
+        if (alarm.m_active && !reported)
+        {
+            handler_alarm_generated(alarm.m_data);
+        }
+        else if (!alarm.m_active)
+        {
+            uint32_t flapCount = m_alarmDamping->takeFlapCount(alarm.m_key);
+
+            if (reported || flapCount)
+            {
+                handler_alarm_cleared(alarm.m_data, flapCount);
+            }
+        }
+    }
+}
+
+void NotificationProcessor::setAlarmDamping(
+    _In_ std::shared_ptr<AlarmDamping> alarmDamping)
+{
+    SWSS_LOG_ENTER();
+
+    m_alarmDamping = alarmDamping;
+}
+
+void NotificationProcessor::publishQueueStatistics()
+{
+    SWSS_LOG_ENTER();
+
+    static const char* names[NOTIFICATION_PRIORITY_MAX] = { "CONTROL", "BULK" };
+
+    for (int priority = 0; priority < NOTIFICATION_PRIORITY_MAX; priority++)
+    {
+        NotificationQueue::Statistics stats;
+
+        m_notificationQueue->getStatistics((notification_priority_t)priority, stats);
+
+        uint64_t waitAvgUs = stats.m_dequeued ? stats.m_waitTotalUs / stats.m_dequeued : 0;
+
+        std::vector<FieldValueTuple> values;
+
+        values.emplace_back("depth", std::to_string(stats.m_depth));
+        values.emplace_back("limit", std::to_string(m_notificationQueue->getQueueSizeLimit()));
+        values.emplace_back("enqueued", std::to_string(stats.m_enqueued));
+        values.emplace_back("dequeued", std::to_string(stats.m_dequeued));
+        values.emplace_back("dropped", std::to_string(stats.m_dropped));
+        values.emplace_back("wait-avg-us", std::to_string(waitAvgUs));
+        values.emplace_back("wait-max-us", std::to_string(stats.m_waitMaxUs));
+
+        m_stateQueueStatsTable->set(names[priority], values);
+    }
+
+    m_stateQueueStatsTable->hset("BULK", "coalesced", std::to_string(m_notificationQueue->getCoalescedCount()));
+}
+
 void NotificationProcessor::ntf_process_function()
 {
     SWSS_LOG_ENTER();
 
-    std::mutex ntf_mutex;
+    auto flushInterval = std::chrono::milliseconds(NOTIFICATION_PROCESSOR_FLUSH_INTERVAL_MS);
+
+    auto statsInterval = std::chrono::milliseconds(NOTIFICATION_QUEUE_STATS_INTERVAL_MS);
 
-    std::unique_lock<std::mutex> ulock(ntf_mutex);
+    auto statsTime = std::chrono::steady_clock::now();
+
+    // statistics changed since they were published
+
+    bool statsPending = false;
+
+    auto ready = [this]() { return !m_runThread || m_notificationQueue->getQueueSize() > 0; };
+
+    std::unique_lock<std::mutex> ulock(m_ntfMutex);
 
     while (m_runThread)
     {
-        m_cv.wait(ulock);
+        // sleep until notification arrives, timeout is used only when held
+        // alarm must be settled or statistics published
+
+        AlarmDamping::time_point_t deadline;
+
+        bool hasDeadline = m_alarmDamping && m_alarmDamping->getNextDeadline(deadline);
+
+        if (statsPending && (!hasDeadline || statsTime + statsInterval < deadline))
+        {
+            deadline = statsTime + statsInterval;
+            hasDeadline = true;
+        }
+
+        if (hasDeadline)
+        {
+            m_cv.wait_until(ulock, deadline, ready);
+        }
+        else
+        {
+            m_cv.wait(ulock, ready);
+        }
+
+        if (!m_runThread)
+        {
+            break;
+        }
+
+        ulock.unlock();
 
         // this is notifications processing thread context, which is different
-        // from OTAI notifications context, we can safe use syncd mutex here,
-        // processing each notification is under same mutex as processing main
-        // events, counters and reinit
+        // from OTAI notifications context, we can safe use syncd state lock
+        // here, each notification is processed under shared lock, so it runs
+        // alongside main events and counters, but not during reinit
 
-        swss::KeyOpFieldsValuesTuple item;
+        std::vector<std::unique_ptr<NotificationItem>> items;
 
-        while (m_notificationQueue->tryDequeue(item))
+        while (m_notificationQueue->tryDequeueBatch(items, NOTIFICATION_PROCESSOR_BATCH_SIZE))
         {
-            processNotification(item);
+            // handlers only queue writes to pipelines, they are flushed once
+            // per batch or when batch takes longer than flush interval
+
+            m_batchWrites = true;
+
+            auto start = std::chrono::steady_clock::now();
+
+            for (auto& item: items)
+            {
+                processNotification(*item);
+
+                if (std::chrono::steady_clock::now() - start >= flushInterval)
+                {
+                    flushPipelines();
+
+                    start = std::chrono::steady_clock::now();
+                }
+            }
+
+            m_batchWrites = false;
+
+            flushPipelines();
+
+            items.clear();
+
+            statsPending = true;
+        }
+
+        processAlarmDamping();
+
+        if (statsPending && std::chrono::steady_clock::now() - statsTime >= statsInterval)
+        {
+            publishQueueStatistics();
+
+            statsTime = std::chrono::steady_clock::now();
+
+            statsPending = false;
         }
+
+        ulock.lock();
     }
 }
 
@@ -639,7 +1342,11 @@ void NotificationProcessor::startNotificationsProcessingThread()
 {
     SWSS_LOG_ENTER();
 
-    m_runThread = true;
+    {
+        std::lock_guard<std::mutex> lock(m_ntfMutex);
+
+        m_runThread = true;
+    }
 
     m_ntf_process_thread = std::make_shared<std::thread>(&NotificationProcessor::ntf_process_function, this);
 }
@@ -648,7 +1355,11 @@ void NotificationProcessor::stopNotificationsProcessingThread()
 {
     SWSS_LOG_ENTER();
 
-    m_runThread = false;
+    {
+        std::lock_guard<std::mutex> lock(m_ntfMutex);
+
+        m_runThread = false;
+    }
 
     m_cv.notify_all();
 
@@ -660,10 +1371,25 @@ void NotificationProcessor::stopNotificationsProcessingThread()
     m_ntf_process_thread = nullptr;
 }
 
+void NotificationProcessor::setOcmStorageMode(
+    _In_ const std::string& mode)
+{
+    SWSS_LOG_ENTER();
+
+    m_ocmPacked = (mode == OCM_STORAGE_MODE_PACKED);
+
+    SWSS_LOG_NOTICE("OCM spectrum storage mode %s", mode.c_str());
+}
+
 void NotificationProcessor::signal()
 {
     SWSS_LOG_ENTER();
 
+    // notification is already in queue, taking the mutex orders this signal
+    // after processing thread either checked queue or started waiting
+
+    std::lock_guard<std::mutex> lock(m_ntfMutex);
+
     m_cv.notify_all();
 }
 
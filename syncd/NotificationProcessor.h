@@ -4,16 +4,72 @@
 #include <thread>
 #include <memory>
 #include <condition_variable>
+#include <chrono>
 #include <functional>
 #include <queue>
+#include <set>
+#include <unordered_map>
 
 #include "otairediscommon.h"
 #include "NotificationQueue.h"
+#include "NotificationItem.h"
+#include "AlarmDamping.h"
 #include "VirtualOidTranslator.h"
 #include "RedisClient.h"
 #include "NotificationProducerBase.h"
 
 #include "swss/notificationproducer.h"
+#include "swss/redispipeline.h"
+
+/*
+ * Syncd internal notification, gauge threshold crossing detected by flex
+ * counter, it is stored as alarm and never forwarded to otairedis.
+ */
+#define SYNCD_NOTIFICATION_NAME_THRESHOLD_CROSSING "threshold_crossing_notify"
+
+/*
+ * Syncd internal notification, linecard communication was lost and all
+ * active alarms must be cleared. Data is clear time in nanoseconds. It is
+ * queued as control item, so it is processed in order with alarms.
+ */
+#define SYNCD_NOTIFICATION_NAME_CLEAR_ACTIVE_ALARMS "clear_active_alarms_notify"
+
+/*
+ * Maximum notifications taken from queue at once by processing thread.
+ */
+#define NOTIFICATION_PROCESSOR_BATCH_SIZE (64)
+
+/*
+ * Maximum time writes of notification batch are held in pipelines before
+ * they are flushed to database.
+ */
+#define NOTIFICATION_PROCESSOR_FLUSH_INTERVAL_MS (10)
+
+/*
+ * Per priority class notification queue statistics in STATE_DB, keyed by
+ * class name and refreshed by processing thread.
+ */
+#define NOTIFICATION_QUEUE_STATS_TABLE "NOTIFICATION_QUEUE_STATS"
+
+#define NOTIFICATION_QUEUE_STATS_INTERVAL_MS (1000)
+
+/*
+ * Table holding whole OCM spectrum in one hash per OCM, used in packed OCM
+ * storage mode.
+ */
+#define STATE_OCM_SPECTRUM_POWER_TABLE_NAME "OCM_SPECTRUM_POWER"
+
+#define OCM_SPECTRUM_EXPIRE_TIME_SECONDS (60)
+
+/*
+ * Per OTDR sorted set in HISTORY_DB indexing history scan and event keys by
+ * scan time, names of all indexed OTDRs are kept in OTDR_INDEX_NAMES set.
+ */
+#define OTDR_HISTORY_INDEX_PREFIX "OTDR_INDEX:"
+#define OTDR_HISTORY_INDEX_NAMES "OTDR_INDEX_NAMES"
+#define OTDR_HISTORY_INDEX_VERSION "OTDR_INDEX_VERSION"
+
+#define OTDR_HISTORY_MAX_SCANS (10)
 
 namespace syncd
 {
@@ -24,7 +80,7 @@ namespace syncd
         NotificationProcessor(
             _In_ std::shared_ptr<NotificationProducerBase> producer,
             _In_ std::shared_ptr<RedisClient> client,
-            _In_ std::function<void(const swss::KeyOpFieldsValuesTuple&)> synchronizer);
+            _In_ std::function<void(const NotificationItem&)> synchronizer);
 
         virtual ~NotificationProcessor();
 
@@ -38,6 +94,26 @@ namespace syncd
 
         void stopNotificationsProcessingThread();
 
+        void setOcmStorageMode(
+            _In_ const std::string& mode);
+
+        /*
+         * Linecard alarm flap damping, disabled when not set.
+         */
+
+        void setAlarmDamping(
+            _In_ std::shared_ptr<AlarmDamping> alarmDamping);
+
+        /*
+         * Object names are cached on first successful lookup, cache entry
+         * must be dropped when object is created or removed.
+         */
+
+        void invalidateResourceName(
+            _In_ otai_object_id_t vid);
+
+        void clearResourceNames();
+
     public:
 
         void ntf_process_function();
@@ -67,42 +143,87 @@ namespace syncd
             _In_ const std::vector<swss::FieldValueTuple>& fv);
 
         void handle_ocm_spectrum_power_notify(
-            _In_ const std::string& data,
-            _In_ const std::vector<swss::FieldValueTuple>& fv);
+            _In_ const OcmSpectrumPowerNotificationItem& item);
 
         void handle_otdr_result_notify(
-            _In_ const std::string& data,
-            _In_ const std::vector<swss::FieldValueTuple>& fv);
+            _In_ const OtdrResultNotificationItem& item);
 
         std::string get_resource_name_by_rid(
             _In_ otai_object_id_t rid);
 
+        std::shared_ptr<std::string> getResourceName(
+            _In_ const std::string& nameMap,
+            _In_ otai_object_id_t vid);
+
         void handle_linecard_alarm(
             _In_ const std::string& data);
 
+        void handle_threshold_crossing(
+            _In_ const std::string& data);
+
         void handler_alarm_generated(
             _In_ const std::string data);
 
         void handler_alarm_cleared(
-            _In_ const std::string data);
+            _In_ const std::string data,
+            _In_ uint32_t flapCount = 0);
 
         void handler_event_generated(
             _In_ const std::string data);
 
+        /*
+         * Clear all active alarms, each clear is recorded in alarm history.
+         */
+        void handle_clear_active_alarms(
+            _In_ const std::string& data);
+
+        /*
+         * Move active alarm to history and remove it from CURALARM, must be
+         * called with m_alarmMutex held.
+         */
+        void clearActiveAlarm(
+            _In_ const std::string& keyid,
+            _In_ const std::string& timeCleared,
+            _In_ uint32_t flapCount);
+
         void handler_history_alarm(
             _In_ const std::string& key,
             _In_ const std::string& timecreated,
             _In_ const std::vector<swss::FieldValueTuple>& alarmvector);
 
         void processNotification(
-            _In_ const swss::KeyOpFieldsValuesTuple& item);
+            _In_ const NotificationItem& item);
+
+        void initOtdrScanIndex();
+
+        void initActiveAlarms();
+
+        void commitPipeline(
+            _In_ swss::RedisPipeline& pipeline);
 
-        void initOtdrScanTimeSet();
+        void flushPipelines();
+
+        void publishQueueStatistics();
+
+        void processAlarmDamping();
+
+        bool isAlarmActive(
+            _In_ const std::string& keyid);
+
+        void migrateOtdrScanIndex();
+
+        bool getOtdrScanTime(
+            _In_ const std::string& name,
+            _In_ const std::string& member,
+            _Out_ uint64_t& scanTime);
+
+        void trimOtdrHistory(
+            _In_ const std::string& name);
 
     public:
 
         void syncProcessNotification(
-            _In_ const swss::KeyOpFieldsValuesTuple& item);
+            _In_ const NotificationItem& item);
 
     public: // TODO to private
 
@@ -115,24 +236,58 @@ namespace syncd
         std::shared_ptr<std::thread> m_ntf_process_thread;
 
         // condition variable will be used to notify processing thread
-        // that some notification arrived
+        // that some notification arrived, producers signal it under
+        // m_ntfMutex, so wakeup can't be lost between check and wait
 
         std::condition_variable m_cv;
 
-        // determine whether notification thread is running
+        std::mutex m_ntfMutex;
+
+        // determine whether notification thread is running, guarded by
+        // m_ntfMutex
 
         bool m_runThread;
 
-        std::function<void(const swss::KeyOpFieldsValuesTuple&)> m_synchronizer;
+        // set while processing thread handles batch, handlers then leave
+        // flushing pipelines to processing thread
+
+        bool m_batchWrites;
+
+        std::function<void(const NotificationItem&)> m_synchronizer;
 
         std::shared_ptr<RedisClient> m_client;
 
         std::shared_ptr<NotificationProducerBase> m_notifications;
         std::shared_ptr<swss::DBConnector> m_state_db;
 
+        std::shared_ptr<swss::DBConnector> m_counters_db;
+
+        std::mutex m_nameMutex;
+
+        std::map<std::string, std::unordered_map<otai_object_id_t, std::string>> m_resourceNames;
+
         std::unique_ptr<swss::Table> m_stateAlarmable;
+
+        std::shared_ptr<swss::RedisPipeline> m_alarmPipeline;
+
+        /*
+         * Authoritative copy of CURALARM, keyed by alarm id, rebuilt from
+         * STATE_DB at startup.
+         */
+
+        std::mutex m_alarmMutex;
+
+        std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> m_activeAlarms;
         std::unique_ptr<swss::Table> m_stateOLPSwitchInfoTbl;
+        std::unique_ptr<swss::Table> m_stateQueueStatsTable;
         std::unique_ptr<swss::Table> m_stateOcmTable;
+        std::unique_ptr<swss::Table> m_stateOcmSpectrumTable;
+
+        std::shared_ptr<swss::RedisPipeline> m_statePipeline;
+
+        bool m_ocmPacked;
+
+        std::shared_ptr<AlarmDamping> m_alarmDamping;
 
         std::shared_ptr<swss::Table> m_stateOtdrTable;
         std::shared_ptr<swss::Table> m_stateOtdrEventTable;
@@ -144,7 +299,9 @@ namespace syncd
         std::shared_ptr<swss::Table> m_historyOtdrTable;
         std::shared_ptr<swss::Table> m_historyOtdrEventTable;
 
-        std::map<std::string, std::queue<uint64_t>> m_otdrScanTimeQueue;
+        std::shared_ptr<swss::RedisPipeline> m_historyPipeline;
+
+        std::map<std::string, std::set<uint64_t>> m_otdrScanTimes;
 
         uint32_t m_ttlPM15Min;
         uint32_t m_ttlPM24Hour;
@@ -1,20 +1,53 @@
 #include "NotificationQueue.h"
 #include "otairediscommon.h"
 
+#include <chrono>
+#include <inttypes.h>
+
 #define NOTIFICATION_QUEUE_DROP_COUNT_INDICATOR (1000)
 
-using namespace syncd;
+// ring item referring to latest payload in coalesce map, data is coalesce key
+#define NOTIFICATION_QUEUE_COALESCE_TOKEN "__coalesced__"
 
-#define MUTEX std::lock_guard<std::mutex> _lock(m_mutex);
+using namespace syncd;
 
 NotificationQueue::NotificationQueue(
         _In_ size_t queueLimit):
-    m_queueSizeLimit(queueLimit),
-    m_dropCount(0)
+    m_controlBurst(0),
+    m_coalescedCount(0)
 {
     SWSS_LOG_ENTER();
 
-    // empty;
+    size_t size = 2;
+
+    while (size < queueLimit)
+    {
+        size <<= 1;
+    }
+
+    m_queueSizeLimit = size;
+
+    for (auto& ring: m_rings)
+    {
+        ring.m_mask = size - 1;
+
+        ring.m_buffer.reset(new Cell[size]);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            ring.m_buffer[i].m_sequence.store(i, std::memory_order_relaxed);
+        }
+
+        ring.m_enqueuePos = 0;
+        ring.m_dequeuePos = 0;
+        ring.m_enqueueCount = 0;
+        ring.m_dropCount = 0;
+        ring.m_dequeueCount = 0;
+        ring.m_waitTotalUs = 0;
+        ring.m_waitMaxUs = 0;
+    }
+
+    SWSS_LOG_NOTICE("notification queue size limit %zu per priority", m_queueSizeLimit);
 }
 
 NotificationQueue::~NotificationQueue()
@@ -25,48 +58,301 @@ NotificationQueue::~NotificationQueue()
 }
 
 bool NotificationQueue::enqueue(
-        _In_ const swss::KeyOpFieldsValuesTuple& item)
+        _In_ std::unique_ptr<NotificationItem>&& item)
+{
+    SWSS_LOG_ENTER();
+
+    return enqueueRing(m_rings[item->getPriority()], std::move(item));
+}
+
+bool NotificationQueue::enqueueRing(
+        _In_ Ring& ring,
+        _In_ std::unique_ptr<NotificationItem>&& item)
 {
-    MUTEX;
+    SWSS_LOG_ENTER();
+
+    size_t pos = ring.m_enqueuePos.load(std::memory_order_relaxed);
+
+    Cell* cell;
+
+    while (true)
+    {
+        cell = &ring.m_buffer[pos & ring.m_mask];
+
+        size_t seq = cell->m_sequence.load(std::memory_order_acquire);
+
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0)
+        {
+            if (ring.m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+
+            // pos was reloaded by failed exchange
+        }
+        else if (diff < 0)
+        {
+            /*
+             * Queue is full, consumer can't keep up. Drop the notification
+             * instead of growing memory without limit.
+             */
+
+            uint64_t dropped = ++ring.m_dropCount;
+
+            if (dropped % NOTIFICATION_QUEUE_DROP_COUNT_INDICATOR == 1)
+            {
+                SWSS_LOG_WARN("notification queue full (limit %zu), dropped %s, total dropped %" PRIu64,
+                        m_queueSizeLimit, item->getName().c_str(), dropped);
+            }
+
+            return false;
+        }
+        else
+        {
+            pos = ring.m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    // every ring item is stamped here, including coalesce tokens, since
+    // consumer measures wait time from the item it takes out of the ring
+
+    item->setEnqueueTime(std::chrono::steady_clock::now());
 
+    cell->m_item = std::move(item);
+
+    cell->m_sequence.store(pos + 1, std::memory_order_release);
+
+    ring.m_enqueueCount.fetch_add(1, std::memory_order_relaxed);
+
+    return true;
+}
+
+bool NotificationQueue::enqueueCoalesced(
+        _In_ const std::string& coalesceKey,
+        _In_ std::unique_ptr<NotificationItem>&& item)
+{
     SWSS_LOG_ENTER();
 
+    notification_priority_t priority = item->getPriority();
+
     /*
-     * If the queue exceeds the limit, then drop all further FDB events This is
-     * a temporary solution to handle high memory usage by syncd and the
-     * notification queue keeps growing. The permanent solution would be to
-     * make this stateful so that only the *latest* event is published.
+     * Token is enqueued and payload published under coalesce mutex, so no
+     * other producer can see the key before token is in ring, and consumer
+     * which takes the token waits on the mutex until payload is published.
+     * Ring enqueue doesn't block, so mutex is held only briefly.
      */
 
-    m_queue.push(item);
+    std::lock_guard<std::mutex> _lock(m_coalesceMutex);
+
+    auto it = m_coalesced.find(coalesceKey);
+
+    if (it != m_coalesced.end())
+    {
+        // token already in ring, just replace stale payload, wait time
+        // is counted from the token
+
+        item->setEnqueueTime(it->second->getEnqueueTime());
+
+        it->second = std::move(item);
+
+        m_coalescedCount.fetch_add(1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    std::unique_ptr<NotificationItem> token(new SerializedNotificationItem(NOTIFICATION_QUEUE_COALESCE_TOKEN, coalesceKey, {}, priority));
+
+    if (!enqueueRing(m_rings[priority], std::move(token)))
+    {
+        return false;
+    }
+
+    item->setEnqueueTime(std::chrono::steady_clock::now());
+
+    m_coalesced.emplace(coalesceKey, std::move(item));
 
     return true;
 }
 
 bool NotificationQueue::tryDequeue(
-        _Out_ swss::KeyOpFieldsValuesTuple& item)
+        _Out_ std::unique_ptr<NotificationItem>& item)
 {
-    MUTEX;
+    SWSS_LOG_ENTER();
+
+    while (tryDequeueNext(item))
+    {
+        if (item->getName() != NOTIFICATION_QUEUE_COALESCE_TOKEN)
+        {
+            return true;
+        }
+
+        const std::string& coalesceKey = static_cast<SerializedNotificationItem&>(*item).getData();
+
+        std::lock_guard<std::mutex> _lock(m_coalesceMutex);
+
+        auto it = m_coalesced.find(coalesceKey);
+
+        if (it != m_coalesced.end())
+        {
+            item = std::move(it->second);
+
+            m_coalesced.erase(it);
+
+            return true;
+        }
+
+        SWSS_LOG_ERROR("coalesced notification %s is missing", coalesceKey.c_str());
+    }
 
+    return false;
+}
+
+bool NotificationQueue::isRingEmpty(
+        _In_ Ring& ring) const
+{
+    SWSS_LOG_ENTER();
+
+    size_t pos = ring.m_dequeuePos.load(std::memory_order_relaxed);
+
+    size_t seq = ring.m_buffer[pos & ring.m_mask].m_sequence.load(std::memory_order_acquire);
+
+    return (intptr_t)seq - (intptr_t)(pos + 1) < 0;
+}
+
+bool NotificationQueue::tryDequeueNext(
+        _Out_ std::unique_ptr<NotificationItem>& item)
+{
+    SWSS_LOG_ENTER();
+
+    Ring& control = m_rings[NOTIFICATION_PRIORITY_CONTROL];
+    Ring& bulk = m_rings[NOTIFICATION_PRIORITY_BULK];
+
+    if (m_controlBurst < NOTIFICATION_QUEUE_CONTROL_BURST && tryDequeueRing(control, item))
+    {
+        m_controlBurst = isRingEmpty(bulk) ? 0 : m_controlBurst + 1;
+
+        return true;
+    }
+
+    m_controlBurst = 0;
+
+    if (tryDequeueRing(bulk, item))
+    {
+        return true;
+    }
+
+    return tryDequeueRing(control, item);
+}
+
+bool NotificationQueue::tryDequeueRing(
+        _In_ Ring& ring,
+        _Out_ std::unique_ptr<NotificationItem>& item)
+{
     SWSS_LOG_ENTER();
 
-    if (m_queue.empty())
+    // single consumer, no need to compare and exchange position
+
+    size_t pos = ring.m_dequeuePos.load(std::memory_order_relaxed);
+
+    Cell* cell = &ring.m_buffer[pos & ring.m_mask];
+
+    size_t seq = cell->m_sequence.load(std::memory_order_acquire);
+
+    if ((intptr_t)seq - (intptr_t)(pos + 1) < 0)
     {
         return false;
     }
 
-    item = m_queue.front();
+    item = std::move(cell->m_item);
+
+    ring.m_dequeuePos.store(pos + 1, std::memory_order_relaxed);
+
+    cell->m_sequence.store(pos + ring.m_mask + 1, std::memory_order_release);
 
-    m_queue.pop();
+    auto wait = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - item->getEnqueueTime()).count();
+
+    uint64_t waitUs = wait > 0 ? (uint64_t)wait : 0;
+
+    ring.m_dequeueCount.fetch_add(1, std::memory_order_relaxed);
+    ring.m_waitTotalUs.fetch_add(waitUs, std::memory_order_relaxed);
+
+    if (waitUs > ring.m_waitMaxUs.load(std::memory_order_relaxed))
+    {
+        ring.m_waitMaxUs.store(waitUs, std::memory_order_relaxed);
+    }
 
     return true;
 }
 
+size_t NotificationQueue::tryDequeueBatch(
+        _Inout_ std::vector<std::unique_ptr<NotificationItem>>& items,
+        _In_ size_t maxItems)
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = 0;
+
+    std::unique_ptr<NotificationItem> item;
+
+    while (count < maxItems && tryDequeue(item))
+    {
+        items.push_back(std::move(item));
+
+        count++;
+    }
+
+    return count;
+}
+
 size_t NotificationQueue::getQueueSize()
 {
-    MUTEX;
+    SWSS_LOG_ENTER();
 
+    size_t size = 0;
+
+    for (auto& ring: m_rings)
+    {
+        size_t enqueuePos = ring.m_enqueuePos.load(std::memory_order_relaxed);
+        size_t dequeuePos = ring.m_dequeuePos.load(std::memory_order_relaxed);
+
+        size += enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+    return size;
+}
+
+size_t NotificationQueue::getQueueSizeLimit() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_queueSizeLimit;
+}
+
+uint64_t NotificationQueue::getCoalescedCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_coalescedCount.load(std::memory_order_relaxed);
+}
+
+void NotificationQueue::getStatistics(
+        _In_ notification_priority_t priority,
+        _Out_ Statistics& stats)
+{
     SWSS_LOG_ENTER();
 
-    return m_queue.size();
+    Ring& ring = m_rings[priority];
+
+    size_t enqueuePos = ring.m_enqueuePos.load(std::memory_order_relaxed);
+    size_t dequeuePos = ring.m_dequeuePos.load(std::memory_order_relaxed);
+
+    stats.m_depth = enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    stats.m_enqueued = ring.m_enqueueCount.load(std::memory_order_relaxed);
+    stats.m_dequeued = ring.m_dequeueCount.load(std::memory_order_relaxed);
+    stats.m_dropped = ring.m_dropCount.load(std::memory_order_relaxed);
+    stats.m_waitTotalUs = ring.m_waitTotalUs.load(std::memory_order_relaxed);
+    stats.m_waitMaxUs = ring.m_waitMaxUs.exchange(0, std::memory_order_relaxed);
 }
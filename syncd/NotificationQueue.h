@@ -1,26 +1,44 @@
 #pragma once
 
-extern "C" {
-#include <otai.h>
-}
-
-#include "swss/table.h"
+#include "NotificationItem.h"
 
-#include <queue>
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 /**
  * @brief Default notification queue size limit.
  *
- * Value based on typical L2 deployment with 256k MAC entries and
- * some extra buffer for other events like port-state, q-deadlock etc
- *
- * TODO: move to config, also this limit only applies to fdb notifications
+ * Value covers alarm storms on linecard communication loss and several OCM
+ * and OTDR reports in flight, while keeping preallocated ring small. Limit is
+ * rounded up to power of two, notifications arriving on full queue are
+ * dropped and counted. Limit applies to each priority class.
+ */
+#define DEFAULT_NOTIFICATION_QUEUE_SIZE_LIMIT (16384)
+
+/**
+ * @brief Number of control notifications dequeued in a row while bulk
+ * notifications are waiting, before one bulk notification is let through.
  */
-#define DEFAULT_NOTIFICATION_QUEUE_SIZE_LIMIT (300000)
+#define NOTIFICATION_QUEUE_CONTROL_BURST (16)
 
 namespace syncd
 {
+    /**
+     * @brief Bounded lock free notification queue.
+     *
+     * Multiple producers (OTAI notification callbacks) and single consumer
+     * (notification processing thread). Each priority class has its own ring,
+     * items are moved in and out of preallocated ring cells, each cell
+     * carries a sequence number telling whether it is ready for producer or
+     * for consumer.
+     *
+     * Control class is drained first, bulk class gets one item after every
+     * NOTIFICATION_QUEUE_CONTROL_BURST control items so it is not starved.
+     */
     class NotificationQueue
     {
         public:
@@ -33,21 +51,131 @@ namespace syncd
         public:
 
             bool enqueue(
-                    _In_ const swss::KeyOpFieldsValuesTuple& msg);
+                    _In_ std::unique_ptr<NotificationItem>&& item);
+
+            /**
+             * @brief Enqueue notification replacing older not yet dequeued
+             * notification with the same coalesce key.
+             *
+             * Only the latest payload per key is kept, so queue depth taken
+             * by coalesced notifications is bounded by number of keys.
+             */
+            bool enqueueCoalesced(
+                    _In_ const std::string& coalesceKey,
+                    _In_ std::unique_ptr<NotificationItem>&& item);
 
             bool tryDequeue(
-                    _Out_ swss::KeyOpFieldsValuesTuple& msg);
+                    _Out_ std::unique_ptr<NotificationItem>& item);
+
+            /**
+             * @brief Dequeue up to maxItems items, appending them to items.
+             *
+             * @return Number of dequeued items.
+             */
+            size_t tryDequeueBatch(
+                    _Inout_ std::vector<std::unique_ptr<NotificationItem>>& items,
+                    _In_ size_t maxItems);
 
             size_t getQueueSize();
 
+            size_t getQueueSizeLimit() const;
+
+            uint64_t getCoalescedCount() const;
+
+        public:
+
+            struct Statistics
+            {
+                size_t m_depth;
+
+                uint64_t m_enqueued;
+
+                uint64_t m_dequeued;
+
+                uint64_t m_dropped;
+
+                uint64_t m_waitTotalUs;
+
+                // maximum wait since previous getStatistics call
+
+                uint64_t m_waitMaxUs;
+            };
+
+            /**
+             * @brief Get counters of priority class.
+             *
+             * Maximum wait time is reset, so must be called by single reader.
+             */
+            void getStatistics(
+                    _In_ notification_priority_t priority,
+                    _Out_ Statistics& stats);
+
         private:
 
-            std::mutex m_mutex;
+            struct Cell
+            {
+                std::atomic<size_t> m_sequence;
+
+                std::unique_ptr<NotificationItem> m_item;
+            };
 
-            std::queue<swss::KeyOpFieldsValuesTuple> m_queue;
+            struct Ring
+            {
+                std::unique_ptr<Cell[]> m_buffer;
+
+                size_t m_mask;
+
+                // producers and consumer positions on separate cache lines
+
+                alignas(64) std::atomic<size_t> m_enqueuePos;
+
+                alignas(64) std::atomic<size_t> m_dequeuePos;
+
+                alignas(64) std::atomic<uint64_t> m_enqueueCount;
+
+                std::atomic<uint64_t> m_dropCount;
+
+                // updated by consumer only
+
+                alignas(64) std::atomic<uint64_t> m_dequeueCount;
+
+                std::atomic<uint64_t> m_waitTotalUs;
+
+                std::atomic<uint64_t> m_waitMaxUs;
+            };
+
+            bool enqueueRing(
+                    _In_ Ring& ring,
+                    _In_ std::unique_ptr<NotificationItem>&& item);
+
+            bool tryDequeueRing(
+                    _In_ Ring& ring,
+                    _Out_ std::unique_ptr<NotificationItem>& item);
+
+            bool tryDequeueNext(
+                    _Out_ std::unique_ptr<NotificationItem>& item);
+
+            bool isRingEmpty(
+                    _In_ Ring& ring) const;
+
+            Ring m_rings[NOTIFICATION_PRIORITY_MAX];
 
             size_t m_queueSizeLimit;
 
-            size_t m_dropCount;
+            // control items dequeued in a row while bulk was waiting
+
+            size_t m_controlBurst;
+
+            std::atomic<uint64_t> m_coalescedCount;
+
+            /*
+             * Latest payload per coalesce key, ring carries only a token
+             * referring to the key. Slow path, used for bulky periodic
+             * notifications like OCM spectrum.
+             */
+
+            std::mutex m_coalesceMutex;
+
+            std::unordered_map<std::string, std::unique_ptr<NotificationItem>> m_coalesced;
     };
 }
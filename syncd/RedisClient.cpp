@@ -16,6 +16,8 @@ using namespace syncd;
 #define HIDDEN                      "HIDDEN"
 #define COLDVIDS                    "COLDVIDS"
 
+#define MUTEX std::lock_guard<std::mutex> _lock(m_mutex);
+
 RedisClient::RedisClient(
         _In_ std::shared_ptr<swss::DBConnector> dbAsic,
         _In_ std::shared_ptr<swss::DBConnector> dbFlexCounter):
@@ -37,6 +39,8 @@ std::unordered_map<otai_object_id_t, otai_object_id_t> RedisClient::getObjectMap
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     auto hash = m_dbAsic->hgetall(key);
 
     std::unordered_map<otai_object_id_t, otai_object_id_t> map;
@@ -122,6 +126,8 @@ void RedisClient::removeAsicObject(
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     otai_object_type_t ot = VidManager::objectTypeQuery(objectVid);
 
     auto strVid = otai_serialize_object_id(objectVid);
@@ -138,6 +144,8 @@ void RedisClient::removeAsicObject(
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     std::string key = (ASIC_STATE_TABLE ":") + otai_serialize_object_meta_key(metaKey);
 
     m_dbAsic->del(key);
@@ -148,6 +156,8 @@ void RedisClient::removeAsicObjects(
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     std::vector<std::string> prefixKeys;
 
     // we need to rewrite keys to add table prefix
@@ -166,6 +176,8 @@ void RedisClient::setAsicObject(
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     std::string key = (ASIC_STATE_TABLE ":") + otai_serialize_object_meta_key(metaKey);
 
     m_dbAsic->hset(key, attr, value);
@@ -177,6 +189,8 @@ void RedisClient::createAsicObject(
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     std::string key = (ASIC_STATE_TABLE ":") + otai_serialize_object_meta_key(metaKey);
 
     if (attrs.size() == 0)
@@ -196,6 +210,8 @@ void RedisClient::createAsicObjects(
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>> hash;
 
     // we need to rewrite hash to add table prefix
@@ -217,6 +233,8 @@ void RedisClient::setVidAndRidMap(
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     m_dbAsic->del(VIDTORID);
     m_dbAsic->del(RIDTOVID);
 
@@ -234,6 +252,8 @@ std::vector<std::string> RedisClient::getAsicStateKeys() const
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     return m_dbAsic->keys(ASIC_STATE_TABLE ":*");
 }
 
@@ -241,6 +261,8 @@ std::vector<std::string> RedisClient::getFlexCounterKeys() const
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     return m_dbFlexcounter->keys(FLEX_COUNTER_TABLE ":*");
 }
 
@@ -248,6 +270,8 @@ std::vector<std::string> RedisClient::getFlexCounterGroupKeys() const
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     return m_dbFlexcounter->keys(FLEX_COUNTER_GROUP_TABLE ":*");
 }
 
@@ -256,6 +280,8 @@ std::unordered_map<std::string, std::string> RedisClient::getAttributesFromAsicK
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     std::unordered_map<std::string, std::string> map;
     m_dbAsic->hgetall(key, std::inserter(map, map.end()));
     return map;
@@ -266,6 +292,8 @@ std::unordered_map<std::string, std::string> RedisClient::getAttributesFromFlexC
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     std::unordered_map<std::string, std::string> map;
     m_dbFlexcounter->hgetall(key, std::inserter(map, map.end()));
     return map;
@@ -276,6 +304,8 @@ std::unordered_map<std::string, std::string> RedisClient::getAttributesFromFlexC
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     std::unordered_map<std::string, std::string> map;
     m_dbFlexcounter->hgetall(key, std::inserter(map, map.end()));
     return map;
@@ -287,6 +317,8 @@ void RedisClient::removeVidAndRid(
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     auto strVid = otai_serialize_object_id(vid);
     auto strRid = otai_serialize_object_id(rid);
 
@@ -300,6 +332,8 @@ void RedisClient::insertVidAndRid(
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     auto strVid = otai_serialize_object_id(vid);
     auto strRid = otai_serialize_object_id(rid);
 
@@ -312,6 +346,8 @@ otai_object_id_t RedisClient::getVidForRid(
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     auto strRid = otai_serialize_object_id(rid);
 
     auto pvid = m_dbAsic->hget(RIDTOVID, strRid);
@@ -336,6 +372,8 @@ otai_object_id_t RedisClient::getRidForVid(
 {
     SWSS_LOG_ENTER();
 
+    MUTEX;
+
     auto strVid = otai_serialize_object_id(vid);
 
     auto prid = m_dbAsic->hget(VIDTORID, strVid);
@@ -10,6 +10,7 @@ extern "C" {
 #include <unordered_map>
 #include <set>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace syncd
@@ -95,5 +96,10 @@ namespace syncd
             std::shared_ptr<swss::DBConnector> m_dbAsic;
             std::shared_ptr<swss::DBConnector> m_dbFlexcounter;
 
+            /**
+             * @brief Guards database connections, client is used from main
+             * and notification processing threads.
+             */
+            mutable std::mutex m_mutex;
     };
 }
@@ -25,5 +25,7 @@ void RedisNotificationProducer::send(
 
     std::vector<swss::FieldValueTuple> vals = values;
 
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     m_notificationProducer->send(op, data, vals);
 }
@@ -5,6 +5,8 @@
 #include "swss/dbconnector.h"
 #include "swss/notificationproducer.h"
 
+#include <mutex>
+
 namespace syncd
 {
     class RedisNotificationProducer:
@@ -26,6 +28,12 @@ namespace syncd
 
         private:
 
+            /**
+             * @brief Notifications are sent from notification processing
+             * thread and from main thread (async request failures).
+             */
+            std::mutex m_mutex;
+
             std::shared_ptr<swss::DBConnector> m_db;
 
             std::shared_ptr<swss::NotificationProducer> m_notificationProducer;
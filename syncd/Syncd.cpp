@@ -13,6 +13,7 @@
 #include "swss/logger.h"
 #include "swss/select.h"
 #include "swss/tokenize.h"
+#include "swss/json.h"
 #include "swss/notificationproducer.h"
 
 #include "meta/otai_serialize.h"
@@ -27,6 +28,14 @@
 #include <chrono>
 #include <unordered_set>
 
+/*
+ * Max number of entries processed from one channel per wakeup under single
+ * lock acquisition, also pop batch size of flex counter consumers. Rest
+ * stays in consumer buffer and is processed on next select, so single busy
+ * channel doesn't delay others.
+ */
+#define SYNCD_EVENT_BATCH_SIZE 128
+
 using namespace syncd;
 using namespace otaimeta;
 using namespace std::placeholders;
@@ -38,6 +47,10 @@ Syncd::Syncd(
     m_commandLineOptions(cmd),
     m_vendorOtai(vendorOtai),
     m_linecard(nullptr),
+    m_asyncRequest(false),
+    m_traceRequest(false),
+    m_lockRequestTime(0),
+    m_lockAcquiredTime(0),
     m_linecardState(OTAI_OPER_STATUS_INACTIVE)
 {
     SWSS_LOG_ENTER();
@@ -47,16 +60,25 @@ Syncd::Syncd(
 
     //flexcounters
     m_dbFlexCounter = std::make_shared<swss::DBConnector>("FLEX_COUNTER_DB", 0);
-    m_flexCounterGroup = std::make_shared<swss::ConsumerTable>(m_dbFlexCounter.get(), FLEX_COUNTER_GROUP_TABLE);
-    m_flexCounter = std::make_shared<swss::ConsumerTable>(m_dbFlexCounter.get(), FLEX_COUNTER_TABLE);
-    m_manager = std::make_shared<FlexCounterManager>(m_vendorOtai, "COUNTERS_DB");
+    m_flexCounterGroup = std::make_shared<swss::ConsumerTable>(m_dbFlexCounter.get(), FLEX_COUNTER_GROUP_TABLE, SYNCD_EVENT_BATCH_SIZE);
+    m_flexCounter = std::make_shared<swss::ConsumerTable>(m_dbFlexCounter.get(), FLEX_COUNTER_TABLE, SYNCD_EVENT_BATCH_SIZE);
 
     m_dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
-    m_client = std::make_shared<RedisClient>(m_dbAsic, m_dbFlexCounter);
+
+    // client is also used by notification thread, it needs own connection
+    m_client = std::make_shared<RedisClient>(std::make_shared<swss::DBConnector>("ASIC_DB", 0), m_dbFlexCounter);
 
     m_state_db = std::shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
     m_linecardtable = std::unique_ptr<Table>(new Table(m_state_db.get(), "LINECARD"));
 
+    m_latencyStatistics = std::make_shared<LatencyStatistics>();
+    m_bulkLatencyStatistics = std::make_shared<LatencyStatistics>(LATENCY_STATS_BULK_KEY_PREFIX);
+    m_latencyStatsTable = std::unique_ptr<Table>(new Table(m_state_db.get(), LATENCY_STATS_TABLE));
+    m_attributeCache = std::make_shared<AttributeCache>();
+    m_attributeCacheStatsTable = std::unique_ptr<Table>(new Table(m_state_db.get(), ATTRIBUTE_CACHE_STATS_TABLE));
+
+    m_statsTimer = std::make_shared<swss::SelectableTimer>(timespec { .tv_sec = LATENCY_STATS_INTERVAL_MS / 1000, .tv_nsec = 0 });
+
     //Quad Events
     m_selectableChannel = std::make_shared<RedisSelectableChannel>(
         m_dbAsic,
@@ -67,6 +89,13 @@ Syncd::Syncd(
     //Notifications
     m_notifications = std::make_shared<RedisNotificationProducer>("ASIC_DB");
     m_processor = std::make_shared<NotificationProcessor>(m_notifications, m_client, std::bind(&Syncd::syncProcessNotification, this, _1));
+    m_processor->setOcmStorageMode(m_commandLineOptions->m_ocmStorageMode);
+
+    if (m_commandLineOptions->m_alarmDampingConfig.size())
+    {
+        m_processor->setAlarmDamping(AlarmDamping::loadFromFile(m_commandLineOptions->m_alarmDampingConfig));
+    }
+
     m_handler = std::make_shared<NotificationHandler>(m_processor);
     m_ln.onLinecardStateChange = std::bind(&NotificationHandler::onLinecardStateChange, m_handler.get(), _1, _2);
     m_ln.onLinecardAlarm = std::bind(&NotificationHandler::onLinecardAlarm, m_handler.get(), _1, _2, _3);
@@ -75,10 +104,15 @@ Syncd::Syncd(
     m_ln.onOtdrReportResult = std::bind(&NotificationHandler::onOtdrReportResult, m_handler.get(), _1, _2, _3);
     m_handler->setLinecardNotifications(m_ln.getLinecardNotifications());
 
+    // gauge threshold crossings are reported through notification handler
+    m_manager = std::make_shared<FlexCounterManager>(m_vendorOtai, "COUNTERS_DB", m_handler);
+
     m_restartQuery = std::make_shared<swss::NotificationConsumer>(m_dbAsic.get(), SYNCD_NOTIFICATION_CHANNEL_RESTARTQUERY);
     m_linecardStateNtf = std::make_shared<swss::NotificationConsumer>(m_dbAsic.get(), SYNCD_NOTIFICATION_CHANNEL_LINECARDSTATE);
+    m_latencyStatsQuery = std::make_shared<swss::NotificationConsumer>(m_dbAsic.get(), SYNCD_NOTIFICATION_CHANNEL_LATENCY_STATS);
 
-    m_redisVidIndexGenerator = std::make_shared<otairedis::RedisVidIndexGenerator>(m_dbAsic, REDIS_KEY_VIDCOUNTER);
+    // used under translator lock only, from main and notification threads
+    m_redisVidIndexGenerator = std::make_shared<otairedis::RedisVidIndexGenerator>(std::make_shared<swss::DBConnector>("ASIC_DB", 0), REDIS_KEY_VIDCOUNTER);
     m_virtualObjectIdManager =
         std::make_shared<otairedis::VirtualObjectIdManager>(
             m_redisVidIndexGenerator);
@@ -114,7 +148,17 @@ void Syncd::processEvent(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    uint64_t lockRequestTime = otairedis::RequestTrace::now();
+
+    std::shared_lock<std::shared_timed_mutex> lock(m_stateMutex);
+
+    uint64_t lockAcquiredTime = otairedis::RequestTrace::now();
+
+    // select doesn't look into consumer buffer, but each entry is published
+    // with its own notification and channel keeps notification count
+    // (hasCachedData), so entries left in buffer are reported by next select
+
+    int count = 0;
 
     do
     {
@@ -122,9 +166,89 @@ void Syncd::processEvent(
 
         consumer.pop(kco);
 
+        if (isExclusiveEvent(kco))
+        {
+            lock.unlock();
+
+            {
+                m_lockRequestTime = otairedis::RequestTrace::now();
+
+                std::unique_lock<std::shared_timed_mutex> exclusive(m_stateMutex);
+
+                m_lockAcquiredTime = otairedis::RequestTrace::now();
+
+                processSingleEvent(kco);
+            }
+
+            lockRequestTime = otairedis::RequestTrace::now();
+
+            lock.lock();
+
+            lockAcquiredTime = otairedis::RequestTrace::now();
+
+            continue;
+        }
+
+        m_lockRequestTime = lockRequestTime;
+        m_lockAcquiredTime = lockAcquiredTime;
+
         processSingleEvent(kco);
+
+        // next request of the batch finds lock already held, so its lock
+        // wait doesn't include processing of this one
+
+        lockRequestTime = lockAcquiredTime = otairedis::RequestTrace::now();
+    }
+    while (!consumer.empty() && ++count < SYNCD_EVENT_BATCH_SIZE);
+}
+
+bool Syncd::processCachedGet(
+    _In_ const otai_object_meta_key_t& metaKey,
+    _In_ uint32_t attr_count,
+    _In_ const otai_attribute_t* attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> entry;
+
+    if (!m_attributeCache->tryGet(metaKey.objecttype, metaKey.objectkey.key.object_id, attr_count, attr_list, entry))
+    {
+        return false;
+    }
+
+    SWSS_LOG_INFO("sending cached response for GET api");
+
+    sendResponse(otai_serialize_status(OTAI_STATUS_SUCCESS), entry);
+
+    return true;
+}
+
+void Syncd::markRequestTrace(
+    _In_ otairedis::RequestTrace::stage_t stage)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_traceRequest)
+    {
+        m_requestTrace.mark(stage);
     }
-    while (!consumer.empty());
+}
+
+bool Syncd::isExclusiveEvent(
+    _In_ const swss::KeyOpFieldsValuesTuple& kco) const
+{
+    SWSS_LOG_ENTER();
+
+    auto& op = kfvOp(kco);
+
+    if (op != REDIS_ASIC_STATE_COMMAND_CREATE && op != REDIS_ASIC_STATE_COMMAND_REMOVE)
+    {
+        return false;
+    }
+
+    static const std::string prefix = otai_serialize_object_type(OTAI_OBJECT_TYPE_LINECARD) + ":";
+
+    return kfvKey(kco).compare(0, prefix.size(), prefix) == 0;
 }
 
 otai_status_t Syncd::processSingleEvent(
@@ -144,6 +268,60 @@ otai_status_t Syncd::processSingleEvent(
         return OTAI_STATUS_SUCCESS;
     }
 
+    m_requestKey = key;
+    m_requestOp = op;
+    m_requestId.clear();
+    m_asyncRequest = false;
+    m_traceRequest = false;
+
+    auto& values = kfvFieldsValues(kco);
+
+    if (values.size() && fvField(values.back()).rfind(REDIS_ASIC_STATE_META_PREFIX, 0) == 0)
+    {
+        // metadata is appended after attributes, strip it before processing
+
+        swss::KeyOpFieldsValuesTuple request = kco;
+
+        auto& requestValues = kfvFieldsValues(request);
+
+        while (requestValues.size() && fvField(requestValues.back()).rfind(REDIS_ASIC_STATE_META_PREFIX, 0) == 0)
+        {
+            if (fvField(requestValues.back()) == REDIS_ASIC_STATE_META_ASYNC)
+            {
+                m_asyncRequest = true;
+            }
+            else if (fvField(requestValues.back()) == REDIS_ASIC_STATE_META_ID)
+            {
+                m_requestId = fvValue(requestValues.back());
+            }
+            else if (fvField(requestValues.back()) == REDIS_ASIC_STATE_META_TRACE)
+            {
+                m_traceRequest = m_requestTrace.deserialize(fvValue(requestValues.back()));
+            }
+
+            requestValues.pop_back();
+        }
+
+        if (m_traceRequest)
+        {
+            m_requestTrace.mark(otairedis::RequestTrace::STAGE_SYNCD_LOCK_REQUEST, m_lockRequestTime);
+            m_requestTrace.mark(otairedis::RequestTrace::STAGE_SYNCD_LOCK_ACQUIRED, m_lockAcquiredTime);
+            m_requestTrace.mark(otairedis::RequestTrace::STAGE_SYNCD_RECEIVE);
+        }
+
+        return processRequest(request);
+    }
+
+    return processRequest(kco);
+}
+
+otai_status_t Syncd::processRequest(
+    _In_ const swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    auto& op = kfvOp(kco);
+
     if (op == REDIS_ASIC_STATE_COMMAND_CREATE)
         return processQuadEvent(OTAI_COMMON_API_CREATE, kco);
 
@@ -156,6 +334,15 @@ otai_status_t Syncd::processSingleEvent(
     if (op == REDIS_ASIC_STATE_COMMAND_GET)
         return processQuadEvent(OTAI_COMMON_API_GET, kco);
 
+    if (op == REDIS_ASIC_STATE_COMMAND_BULK_CREATE)
+        return processBulkQuadEvent(OTAI_COMMON_API_CREATE, kco);
+
+    if (op == REDIS_ASIC_STATE_COMMAND_BULK_REMOVE)
+        return processBulkQuadEvent(OTAI_COMMON_API_REMOVE, kco);
+
+    if (op == REDIS_ASIC_STATE_COMMAND_BULK_SET)
+        return processBulkQuadEvent(OTAI_COMMON_API_SET, kco);
+
     SWSS_LOG_THROW("event op '%s' is not implemented, FIXME", op.c_str());
 }
 
@@ -227,11 +414,28 @@ void Syncd::sendApiResponse(
 
     std::string strStatus = otai_serialize_status(status);
 
+    if (m_asyncRequest)
+    {
+        // otairedis is not waiting for response, only failure is reported
+
+        if (status != OTAI_STATUS_SUCCESS)
+        {
+            std::vector<swss::FieldValueTuple> values;
+
+            values.emplace_back("status", strStatus);
+            values.emplace_back("op", m_requestOp);
+
+            m_notifications->send(OTAI_REDIS_NOTIFICATION_NAME_ASYNC_FAILURE, m_requestKey, values);
+        }
+
+        return;
+    }
+
     SWSS_LOG_INFO("sending response for %s api with status: %s",
         otai_serialize_common_api(api).c_str(),
         strStatus.c_str());
 
-    m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    sendResponse(strStatus, entry);
 
     SWSS_LOG_INFO("response for %s api was send",
         otai_serialize_common_api(api).c_str());
@@ -242,11 +446,22 @@ void Syncd::processFlexCounterGroupEvent( // TODO must be moved to go via ASIC c
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::shared_lock<std::shared_timed_mutex> lock(m_stateMutex);
 
-    swss::KeyOpFieldsValuesTuple kco;
+    std::deque<swss::KeyOpFieldsValuesTuple> entries;
 
-    consumer.pop(kco);
+    consumer.pops(entries);
+
+    for (auto& kco: entries)
+    {
+        processFlexCounterGroupEntry(kco);
+    }
+}
+
+void Syncd::processFlexCounterGroupEntry(
+    _In_ const swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
 
     auto& groupName = kfvKey(kco);
     auto& op = kfvOp(kco);
@@ -273,11 +488,22 @@ void Syncd::processFlexCounterEvent( // TODO must be moved to go via ASIC channe
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::shared_lock<std::shared_timed_mutex> lock(m_stateMutex);
+
+    std::deque<swss::KeyOpFieldsValuesTuple> entries;
 
-    swss::KeyOpFieldsValuesTuple kco;
+    consumer.pops(entries);
+
+    for (auto& kco: entries)
+    {
+        processFlexCounterEntry(kco);
+    }
+}
 
-    consumer.pop(kco);
+void Syncd::processFlexCounterEntry(
+    _Inout_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
 
     auto& key = kfvKey(kco);
     auto& op = kfvOp(kco);
@@ -353,16 +579,22 @@ void Syncd::syncUpdateRedisQuadEvent(
     {
     case OTAI_COMMON_API_CREATE:
     {
+        m_attributeCache->update(metaKey.objecttype, metaKey.objectkey.key.object_id, values);
+
         m_client->createAsicObject(metaKey, values);
         break;
     }
     case OTAI_COMMON_API_REMOVE:
     {
+        m_attributeCache->remove(metaKey.objectkey.key.object_id);
+
         m_client->removeAsicObject(metaKey);
         break;
     }
     case OTAI_COMMON_API_SET:
     {
+        m_attributeCache->update(metaKey.objecttype, metaKey.objectkey.key.object_id, values);
+
         auto& first = values.at(0);
 
         auto& attr = fvField(first);
@@ -399,6 +631,8 @@ otai_status_t Syncd::processQuadEvent(
 {
     SWSS_LOG_ENTER();
 
+    auto time = std::chrono::steady_clock::now();
+
     const std::string& key = kfvKey(kco);
     const std::string& op = kfvOp(kco);
 
@@ -449,6 +683,15 @@ otai_status_t Syncd::processQuadEvent(
         m_handler->updateNotificationsPointers(metaKey.objecttype, attr_count, attr_list);
     }
 
+    time = m_latencyStatistics->record(api, metaKey.objecttype, LATENCY_STAGE_DESERIALIZE, time);
+
+    if (api == OTAI_COMMON_API_GET && processCachedGet(metaKey, attr_count, attr_list))
+    {
+        m_latencyStatistics->record(api, metaKey.objecttype, LATENCY_STAGE_RESPONSE, time);
+
+        return OTAI_STATUS_SUCCESS;
+    }
+
     if (api != OTAI_COMMON_API_GET)
     {
         /*
@@ -460,12 +703,22 @@ otai_status_t Syncd::processQuadEvent(
         SWSS_LOG_DEBUG("translating VID to RIDs on all attributes");
 
         m_translator->translateVidToRid(metaKey.objecttype, attr_count, attr_list);
+
+        time = m_latencyStatistics->record(api, metaKey.objecttype, LATENCY_STAGE_TRANSLATE, time);
     }
 
     otai_status_t status;
 
+    markRequestTrace(otairedis::RequestTrace::STAGE_VENDOR_START);
+
     status = processOid(metaKey.objecttype, strObjectId, api, attr_count, attr_list);
 
+    markRequestTrace(otairedis::RequestTrace::STAGE_VENDOR_END);
+
+    // vendor stage includes translation of object id itself
+
+    time = m_latencyStatistics->record(api, metaKey.objecttype, LATENCY_STAGE_VENDOR, time);
+
     if (api == OTAI_COMMON_API_GET)
     {
         if (status != OTAI_STATUS_SUCCESS)
@@ -506,11 +759,298 @@ otai_status_t Syncd::processQuadEvent(
         sendApiResponse(api, status);
     }
 
+    time = m_latencyStatistics->record(api, metaKey.objecttype, LATENCY_STAGE_RESPONSE, time);
+
     syncUpdateRedisQuadEvent(status, api, kco);
 
+    m_latencyStatistics->record(api, metaKey.objecttype, LATENCY_STAGE_ASIC_DB, time);
+
+    return status;
+}
+
+otai_status_t Syncd::processBulkQuadEvent(
+    _In_ otai_common_api_t api,
+    _In_ const swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    auto time = std::chrono::steady_clock::now();
+
+    const std::string& key = kfvKey(kco); // objectType:count
+    const std::string& op = kfvOp(kco);
+
+    const std::string strObjectType = key.substr(0, key.find(":"));
+
+    auto& values = kfvFieldsValues(kco);
+
+    uint32_t object_count = (uint32_t)values.size();
+
+    // malformed objects are answered with per object status, so client
+    // doesn't wait for response until timeout
+
+    std::vector<otai_status_t> statuses(object_count, OTAI_STATUS_INVALID_PARAMETER);
+
+    otai_object_type_t objectType = OTAI_OBJECT_TYPE_NULL;
+
+    try
+    {
+        otai_deserialize_object_type(strObjectType, objectType);
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to deserialize object type %s: %s", key.c_str(), e.what());
+    }
+
+    if (!otai_metadata_is_object_type_valid(objectType) || objectType == OTAI_OBJECT_TYPE_LINECARD)
+    {
+        SWSS_LOG_ERROR("invalid bulk object type %s", key.c_str());
+
+        sendApiResponse(api, OTAI_STATUS_INVALID_PARAMETER, object_count, statuses.data());
+
+        return OTAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::vector<std::vector<swss::FieldValueTuple>> objectValues(object_count);
+
+    // objects which passed validation, passed to vendor
+
+    std::vector<uint32_t> indexes;
+    std::vector<otai_object_id_t> vids;
+    std::vector<otai_object_id_t> rids;
+    std::vector<otai_object_id_t> linecardRids;
+    std::vector<std::shared_ptr<OtaiAttributeList>> lists;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        auto& v = values[idx];
+
+        try
+        {
+            // stale or unknown VID fails only this object
+
+            otai_object_id_t vid;
+            otai_deserialize_object_id(fvField(v), vid);
+
+            otai_object_id_t rid = OTAI_NULL_OBJECT_ID;
+            otai_object_id_t linecardRid = OTAI_NULL_OBJECT_ID;
+
+            if (api == OTAI_COMMON_API_CREATE)
+            {
+                linecardRid = m_translator->translateVidToRid(VidManager::linecardIdQuery(vid));
+            }
+            else
+            {
+                rid = m_translator->translateVidToRid(vid);
+            }
+
+            if (api != OTAI_COMMON_API_REMOVE)
+            {
+                // each object attributes are json array of field/value pairs
+
+                swss::JSon::readJson(fvValue(v), objectValues[idx]);
+            }
+
+            if (api == OTAI_COMMON_API_SET && objectValues[idx].size() != 1)
+            {
+                SWSS_LOG_ERROR("bulk set expects single attribute on %s, got %zu",
+                    fvField(v).c_str(),
+                    objectValues[idx].size());
+
+                continue;
+            }
+
+            auto list = std::make_shared<OtaiAttributeList>(objectType, objectValues[idx], false);
+
+            if (api == OTAI_COMMON_API_CREATE || api == OTAI_COMMON_API_SET)
+            {
+                m_handler->updateNotificationsPointers(objectType, list->get_attr_count(), list->get_attr_list());
+            }
+
+            m_translator->translateVidToRid(objectType, list->get_attr_count(), list->get_attr_list());
+
+            indexes.push_back(idx);
+            vids.push_back(vid);
+            rids.push_back(rid);
+            linecardRids.push_back(linecardRid);
+            lists.push_back(list);
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("invalid bulk %s object %s:%s: %s",
+                otai_serialize_common_api(api).c_str(),
+                strObjectType.c_str(),
+                fvField(v).c_str(),
+                e.what());
+        }
+    }
+
+    // deserialize stage of bulk includes VID translation, they are done per
+    // object in single pass
+
+    time = m_bulkLatencyStatistics->record(api, objectType, LATENCY_STAGE_DESERIALIZE, time);
+
+    SWSS_LOG_INFO("bulk %s %zu of %u objects of %s",
+        otai_serialize_common_api(api).c_str(),
+        indexes.size(),
+        object_count,
+        strObjectType.c_str());
+
+    std::vector<otai_status_t> vendorStatuses(indexes.size(), OTAI_STATUS_FAILURE);
+
+    markRequestTrace(otairedis::RequestTrace::STAGE_VENDOR_START);
+
+    if (indexes.empty())
+    {
+        // nothing valid to pass to vendor
+    }
+    else if (m_commandLineOptions->m_enableOtaiBulkSupport)
+    {
+        // otairedis allocates all objects in bulk on single linecard
+
+        processBulkOid(objectType, vids, rids, linecardRids.at(0), api, lists, vendorStatuses);
+    }
+    else
+    {
+        for (size_t idx = 0; idx < indexes.size(); idx++)
+        {
+            switch (api)
+            {
+            case OTAI_COMMON_API_CREATE:
+                vendorStatuses[idx] = processOidCreate(objectType, vids[idx], linecardRids[idx],
+                    lists[idx]->get_attr_count(), lists[idx]->get_attr_list());
+                break;
+
+            case OTAI_COMMON_API_REMOVE:
+                vendorStatuses[idx] = processOidRemove(objectType, vids[idx], rids[idx]);
+                break;
+
+            case OTAI_COMMON_API_SET:
+                vendorStatuses[idx] = processOidSet(objectType, rids[idx], lists[idx]->get_attr_list());
+                break;
+
+            default:
+                SWSS_LOG_THROW("bulk api (%s) is not implemented", otai_serialize_common_api(api).c_str());
+            }
+        }
+    }
+
+    markRequestTrace(otairedis::RequestTrace::STAGE_VENDOR_END);
+
+    time = m_bulkLatencyStatistics->record(api, objectType, LATENCY_STAGE_VENDOR, time);
+
+    for (size_t idx = 0; idx < indexes.size(); idx++)
+    {
+        statuses[indexes[idx]] = vendorStatuses[idx];
+    }
+
+    otai_status_t status = OTAI_STATUS_SUCCESS;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        if (statuses[idx] != OTAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("bulk %s %s:%s failed: %s",
+                otai_serialize_common_api(api).c_str(),
+                strObjectType.c_str(),
+                fvField(values[idx]).c_str(),
+                otai_serialize_status(statuses[idx]).c_str());
+
+            status = OTAI_STATUS_FAILURE;
+        }
+    }
+
+    sendApiResponse(api, status, object_count, statuses.data());
+
+    time = m_bulkLatencyStatistics->record(api, objectType, LATENCY_STAGE_RESPONSE, time);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        swss::KeyOpFieldsValuesTuple objectKco(strObjectType + ":" + fvField(values[idx]), op, objectValues[idx]);
+
+        syncUpdateRedisQuadEvent(statuses[idx], api, objectKco);
+    }
+
+    m_bulkLatencyStatistics->record(api, objectType, LATENCY_STAGE_ASIC_DB, time);
+
     return status;
 }
 
+void Syncd::processBulkOid(
+    _In_ otai_object_type_t objectType,
+    _In_ const std::vector<otai_object_id_t>& vids,
+    _Inout_ std::vector<otai_object_id_t>& rids,
+    _In_ otai_object_id_t linecardRid,
+    _In_ otai_common_api_t api,
+    _In_ const std::vector<std::shared_ptr<otaimeta::OtaiAttributeList>>& lists,
+    _Out_ std::vector<otai_status_t>& statuses)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t object_count = (uint32_t)vids.size();
+
+    switch (api)
+    {
+    case OTAI_COMMON_API_CREATE:
+    {
+        std::vector<uint32_t> attr_counts;
+        std::vector<const otai_attribute_t*> attr_lists;
+
+        for (auto& list: lists)
+        {
+            attr_counts.push_back(list->get_attr_count());
+            attr_lists.push_back(list->get_attr_list());
+        }
+
+        m_vendorOtai->bulkCreate(objectType, linecardRid, object_count,
+            attr_counts.data(), attr_lists.data(), rids.data(), statuses.data());
+
+        for (uint32_t idx = 0; idx < object_count; idx++)
+        {
+            if (statuses[idx] == OTAI_STATUS_SUCCESS)
+            {
+                saveCreatedOid(vids[idx], rids[idx]);
+            }
+        }
+
+        break;
+    }
+
+    case OTAI_COMMON_API_REMOVE:
+
+        m_vendorOtai->bulkRemove(objectType, object_count, rids.data(), statuses.data());
+
+        for (uint32_t idx = 0; idx < object_count; idx++)
+        {
+            if (statuses[idx] == OTAI_STATUS_SUCCESS)
+            {
+                m_translator->eraseRidAndVid(rids[idx], vids[idx]);
+
+                m_processor->invalidateResourceName(vids[idx]);
+            }
+        }
+
+        break;
+
+    case OTAI_COMMON_API_SET:
+    {
+        std::vector<otai_attribute_t> attrs;
+
+        for (auto& list: lists)
+        {
+            attrs.push_back(list->get_attr_list()[0]);
+        }
+
+        m_vendorOtai->bulkSet(objectType, object_count, rids.data(), attrs.data(), statuses.data());
+
+        break;
+    }
+
+    default:
+
+        SWSS_LOG_THROW("bulk api (%s) is not implemented", otai_serialize_common_api(api).c_str());
+    }
+}
+
 otai_status_t Syncd::processOid(
     _In_ otai_object_type_t objectType,
     _In_ const std::string& strObjectId,
@@ -585,32 +1125,27 @@ otai_status_t Syncd::processOidCreate(
         linecardRid = m_translator->translateVidToRid(linecardVid);
     }
 
+    return processOidCreate(objectType, objectVid, linecardRid, attr_count, attr_list);
+}
+
+otai_status_t Syncd::processOidCreate(
+    _In_ otai_object_type_t objectType,
+    _In_ otai_object_id_t objectVid,
+    _In_ otai_object_id_t linecardRid,
+    _In_ uint32_t attr_count,
+    _In_ otai_attribute_t* attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    otai_object_id_t linecardVid = VidManager::linecardIdQuery(objectVid);
+
     otai_object_id_t objectRid;
 
     otai_status_t status = m_vendorOtai->create(objectType, &objectRid, linecardRid, attr_count, attr_list);
 
     if (status == OTAI_STATUS_SUCCESS)
     {
-
-        otai_object_id_t objectVidOld;
-
-        if (m_translator->tryTranslateRidToVid(objectRid, objectVidOld))
-        {
-            m_translator->eraseRidAndVid(objectRid, objectVidOld);
-
-            m_client->removeAsicObject(objectVidOld);
-        }
-
-        /*
-         * Object was created so new object id was generated we need to save
-         * virtual id's to redis db.
-         */
-
-        m_translator->insertRidAndVid(objectRid, objectVid);
-
-        SWSS_LOG_INFO("saved VID %s to RID %s",
-            otai_serialize_object_id(objectVid).c_str(),
-            otai_serialize_object_id(objectRid).c_str());
+        saveCreatedOid(objectVid, objectRid);
 
         if (objectType == OTAI_OBJECT_TYPE_LINECARD)
         {
@@ -619,12 +1154,47 @@ otai_status_t Syncd::processOidCreate(
              * constructor, like getting all queues, ports, etc.
              */
             m_linecard = std::make_shared<OtaiLinecard>(linecardVid, objectRid, m_client, m_translator, m_vendorOtai);
+
+            m_processor->clearResourceNames();
         }
     }
 
     return status;
 }
 
+void Syncd::saveCreatedOid(
+    _In_ otai_object_id_t objectVid,
+    _In_ otai_object_id_t objectRid)
+{
+    SWSS_LOG_ENTER();
+
+    otai_object_id_t objectVidOld;
+
+    if (m_translator->tryTranslateRidToVid(objectRid, objectVidOld))
+    {
+        m_translator->eraseRidAndVid(objectRid, objectVidOld);
+
+        m_client->removeAsicObject(objectVidOld);
+
+        m_attributeCache->remove(objectVidOld);
+
+        m_processor->invalidateResourceName(objectVidOld);
+    }
+
+    /*
+     * Object was created so new object id was generated we need to save
+     * virtual id's to redis db.
+     */
+
+    m_translator->insertRidAndVid(objectRid, objectVid);
+
+    m_processor->invalidateResourceName(objectVid);
+
+    SWSS_LOG_INFO("saved VID %s to RID %s",
+        otai_serialize_object_id(objectVid).c_str(),
+        otai_serialize_object_id(objectRid).c_str());
+}
+
 otai_status_t Syncd::processOidRemove(
     _In_ otai_object_type_t objectType,
     _In_ const std::string& strObjectId)
@@ -636,6 +1206,16 @@ otai_status_t Syncd::processOidRemove(
 
     otai_object_id_t rid = m_translator->translateVidToRid(objectVid);
 
+    return processOidRemove(objectType, objectVid, rid);
+}
+
+otai_status_t Syncd::processOidRemove(
+    _In_ otai_object_type_t objectType,
+    _In_ otai_object_id_t objectVid,
+    _In_ otai_object_id_t rid)
+{
+    SWSS_LOG_ENTER();
+
     otai_status_t status = m_vendorOtai->remove(objectType, rid);
 
     if (status == OTAI_STATUS_SUCCESS)
@@ -645,6 +1225,8 @@ otai_status_t Syncd::processOidRemove(
 
         m_translator->eraseRidAndVid(rid, objectVid);
 
+        m_processor->invalidateResourceName(objectVid);
+
         if (objectType == OTAI_OBJECT_TYPE_LINECARD)
         {
             /*
@@ -675,9 +1257,17 @@ otai_status_t Syncd::processOidSet(
 
     otai_object_id_t rid = m_translator->translateVidToRid(objectVid);
 
-    otai_status_t status = m_vendorOtai->set(objectType, rid, attr);
+    return processOidSet(objectType, rid, attr);
+}
 
-    return status;
+otai_status_t Syncd::processOidSet(
+    _In_ otai_object_type_t objectType,
+    _In_ otai_object_id_t rid,
+    _In_ otai_attribute_t* attr)
+{
+    SWSS_LOG_ENTER();
+
+    return m_vendorOtai->set(objectType, rid, attr);
 }
 
 otai_status_t Syncd::processOidGet(
@@ -848,21 +1438,45 @@ void Syncd::sendGetResponse(
     SWSS_LOG_INFO("sending response for GET api with status: %s", strStatus.c_str());
 
     /*
-     * Since we have only one get at a time, we don't have to serialize object
-     * type and object id, only get status is required to be returned.  Get
-     * response will not put any data to table, only queue is used.
+     * Response is matched with request by echoed correlation id, so we don't
+     * have to serialize object type and object id, only get status is
+     * required to be returned.  Get response will not put any data to table,
+     * only queue is used.
      */
 
-    m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    sendResponse(strStatus, entry);
 
     SWSS_LOG_INFO("response for GET api was send");
 }
 
+void Syncd::sendResponse(
+    _In_ const std::string& strStatus,
+    _Inout_ std::vector<swss::FieldValueTuple>& entry)
+{
+    SWSS_LOG_ENTER();
+
+    // trace goes before correlation id, which otairedis expects last
+
+    if (m_traceRequest)
+    {
+        m_requestTrace.mark(otairedis::RequestTrace::STAGE_SYNCD_RESPONSE);
+
+        entry.emplace_back(REDIS_ASIC_STATE_META_TRACE, m_requestTrace.serialize());
+    }
+
+    if (m_requestId.size())
+    {
+        entry.emplace_back(REDIS_ASIC_STATE_META_ID, m_requestId);
+    }
+
+    m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+}
+
 void Syncd::onSyncdStart()
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_lock<std::shared_timed_mutex> lock(m_stateMutex);
 
     SWSS_LOG_TIMER("on syncd start");
     SWSS_LOG_NOTICE("performing syncd reinit");
@@ -871,6 +1485,10 @@ void Syncd::onSyncdStart()
 
     m_linecard = hr.hardReinit();
 
+    m_processor->clearResourceNames();
+
+    m_attributeCache->clear();
+
     SWSS_LOG_NOTICE("syncd reinit succeeded");
 }
 
@@ -878,7 +1496,7 @@ void Syncd::sendShutdownRequestAfterException()
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_lock<std::shared_timed_mutex> lock(m_stateMutex);
 
     try
     {
@@ -978,9 +1596,9 @@ otai_status_t Syncd::removeLinecard()
 }
 
 void Syncd::syncProcessNotification(
-    _In_ const swss::KeyOpFieldsValuesTuple& item)
+    _In_ const NotificationItem& item)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::shared_lock<std::shared_timed_mutex> lock(m_stateMutex);
 
     SWSS_LOG_ENTER();
 
@@ -1015,6 +1633,10 @@ void Syncd::run()
         s->addSelectable(m_linecardStateNtf.get());
         s->addSelectable(m_flexCounter.get());
         s->addSelectable(m_flexCounterGroup.get());
+        s->addSelectable(m_latencyStatsQuery.get());
+        s->addSelectable(m_statsTimer.get());
+
+        m_statsTimer->start();
 
         SWSS_LOG_NOTICE("starting main loop");
     }
@@ -1068,6 +1690,12 @@ void Syncd::run()
 
                 if (m_linecardState != linecard_state)
                 {
+                    std::unique_lock<std::shared_timed_mutex> lock(m_stateMutex);
+
+                    // hardware state may not match what was set before
+
+                    m_attributeCache->clear();
+
                     if (linecard_state == OTAI_OPER_STATUS_INACTIVE)
                     {
                         m_manager->removeAllCounters();
@@ -1127,6 +1755,16 @@ void Syncd::run()
             {
                 processEvent(*m_selectableChannel.get());
             }
+            else if (sel == m_statsTimer.get())
+            {
+                m_latencyStatistics->publish(*m_latencyStatsTable);
+                m_bulkLatencyStatistics->publish(*m_latencyStatsTable);
+                m_attributeCache->publish(*m_attributeCacheStatsTable);
+            }
+            else if (sel == m_latencyStatsQuery.get())
+            {
+                handleLatencyStatsQuery(*m_latencyStatsQuery);
+            }
             else
             {
                 SWSS_LOG_ERROR("select failed: %d", result);
@@ -1207,6 +1845,33 @@ otai_oper_status_t Syncd::handleLinecardState(
     return linecard_oper_status;
 }
 
+void Syncd::handleLatencyStatsQuery(
+    _In_ swss::NotificationConsumer& latencyStatsQuery)
+{
+    SWSS_LOG_ENTER();
+
+    std::string op;
+    std::string data;
+    std::vector<swss::FieldValueTuple> values;
+
+    latencyStatsQuery.pop(op, data, values);
+
+    if (op != LATENCY_STATS_OP_RESET)
+    {
+        SWSS_LOG_WARN("unknown latency stats op: %s", op.c_str());
+
+        return;
+    }
+
+    SWSS_LOG_NOTICE("resetting latency statistics");
+
+    m_latencyStatistics->reset();
+    m_bulkLatencyStatistics->reset();
+
+    m_latencyStatistics->publish(*m_latencyStatsTable);
+    m_bulkLatencyStatistics->publish(*m_latencyStatsTable);
+}
+
 void Syncd::notifyLinecardStateChange(otai_oper_status_t status) 
 {
     SWSS_LOG_ENTER();
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 
 #include "CommandLineOptions.h"
 #include "FlexCounterManager.h"
@@ -14,8 +15,11 @@
 #include "LinecardNotifications.h"
 #include "ServiceMethodTable.h"
 #include "RedisVidIndexGenerator.h"
+#include "RequestTrace.h"
 #include "NotificationProducerBase.h"
 #include "SelectableChannel.h"
+#include "LatencyStatistics.h"
+#include "AttributeCache.h"
 
 #include "meta/OtaiAttributeList.h"
 
@@ -26,6 +30,7 @@
 #include "swss/dbconnector.h"
 #include "swss/select.h"
 #include "swss/selectableevent.h"
+#include "swss/selectabletimer.h"
 #include "swss/table.h"
 #include "swss/subscriberstatetable.h"
 
@@ -63,6 +68,12 @@ namespace syncd
         void processFlexCounterEvent(
             _In_ swss::ConsumerTable& consumer);
 
+        void processFlexCounterGroupEntry(
+            _In_ const swss::KeyOpFieldsValuesTuple& kco);
+
+        void processFlexCounterEntry(
+            _Inout_ swss::KeyOpFieldsValuesTuple& kco);
+
         const char* profileGetValue(
             _In_ otai_linecard_profile_id_t profile_id,
             _In_ const char* variable);
@@ -92,6 +103,39 @@ namespace syncd
         otai_status_t processSingleEvent(
             _In_ const swss::KeyOpFieldsValuesTuple& kco);
 
+        /**
+         * @brief Check if event must be processed with exclusive state lock.
+         *
+         * Linecard create and remove populate and clear VID/RID maps of
+         * entire linecard, notifications can't be translated meanwhile.
+         */
+        bool isExclusiveEvent(
+            _In_ const swss::KeyOpFieldsValuesTuple& kco) const;
+
+        /**
+         * @brief Mark stage of current request, if request is traced.
+         */
+        void markRequestTrace(
+            _In_ otairedis::RequestTrace::stage_t stage);
+
+        /**
+         * @brief Answer GET from attribute cache.
+         *
+         * @return True when response was sent, false when GET must go to
+         * vendor.
+         */
+        bool processCachedGet(
+            _In_ const otai_object_meta_key_t& metaKey,
+            _In_ uint32_t attr_count,
+            _In_ const otai_attribute_t* attr_list);
+
+        /**
+         * @brief Dispatch request by operation, request metadata is already
+         * stripped.
+         */
+        otai_status_t processRequest(
+            _In_ const swss::KeyOpFieldsValuesTuple& kco);
+
         otai_status_t processClearStatsEvent(
             _In_ const swss::KeyOpFieldsValuesTuple& kco);
 
@@ -109,6 +153,33 @@ namespace syncd
             _In_ uint32_t attr_count,
             _In_ otai_attribute_t* attr_list);
 
+        /**
+         * @brief Process bulk create/remove/set.
+         *
+         * All objects are processed regardless of failures, status of each
+         * object is returned to otairedis in single response.
+         */
+        otai_status_t processBulkQuadEvent(
+            _In_ otai_common_api_t api,
+            _In_ const swss::KeyOpFieldsValuesTuple& kco);
+
+        /**
+         * @brief Process bulk using vendor bulk api, enabled by
+         * --enableOtaiBulkSupport. Vendor without bulk api falls back to
+         * per object calls inside OtaiInterface.
+         *
+         * Objects are already validated and translated, rids are filled by
+         * create.
+         */
+        void processBulkOid(
+            _In_ otai_object_type_t objectType,
+            _In_ const std::vector<otai_object_id_t>& vids,
+            _Inout_ std::vector<otai_object_id_t>& rids,
+            _In_ otai_object_id_t linecardRid,
+            _In_ otai_common_api_t api,
+            _In_ const std::vector<std::shared_ptr<otaimeta::OtaiAttributeList>>& lists,
+            _Out_ std::vector<otai_status_t>& statuses);
+
     private: // process quad oid
 
         otai_status_t processOidCreate(
@@ -117,15 +188,36 @@ namespace syncd
             _In_ uint32_t attr_count,
             _In_ otai_attribute_t* attr_list);
 
+        otai_status_t processOidCreate(
+            _In_ otai_object_type_t objectType,
+            _In_ otai_object_id_t objectVid,
+            _In_ otai_object_id_t linecardRid,
+            _In_ uint32_t attr_count,
+            _In_ otai_attribute_t* attr_list);
+
+        void saveCreatedOid(
+            _In_ otai_object_id_t objectVid,
+            _In_ otai_object_id_t objectRid);
+
         otai_status_t processOidRemove(
             _In_ otai_object_type_t objectType,
             _In_ const std::string& strObjectId);
 
+        otai_status_t processOidRemove(
+            _In_ otai_object_type_t objectType,
+            _In_ otai_object_id_t objectVid,
+            _In_ otai_object_id_t rid);
+
         otai_status_t processOidSet(
             _In_ otai_object_type_t objectType,
             _In_ const std::string& strObjectId,
             _In_ otai_attribute_t* attr);
 
+        otai_status_t processOidSet(
+            _In_ otai_object_type_t objectType,
+            _In_ otai_object_id_t rid,
+            _In_ otai_attribute_t* attr);
+
         otai_status_t processOidGet(
             _In_ otai_object_type_t objectType,
             _In_ const std::string& strObjectId,
@@ -148,7 +240,7 @@ namespace syncd
             _In_ otai_attribute_t* attr_list);
 
         void syncProcessNotification(
-            _In_ const swss::KeyOpFieldsValuesTuple& item);
+            _In_ const NotificationItem& item);
 
     private:
         otai_oper_status_t handleLinecardState(
@@ -156,6 +248,9 @@ namespace syncd
         
         void notifyLinecardStateChange(otai_oper_status_t status); 
 
+        void handleLatencyStatsQuery(
+            _In_ swss::NotificationConsumer& latencyStatsQuery);
+
         void waitLinecardStateActive();
 
     private:
@@ -174,6 +269,13 @@ namespace syncd
             _In_ uint32_t object_count = 0,
             _In_ otai_status_t* object_statuses = NULL);
 
+        /**
+         * @brief Send response tagged with correlation id of current request.
+         */
+        void sendResponse(
+            _In_ const std::string& strStatus,
+            _Inout_ std::vector<swss::FieldValueTuple>& entry);
+
         void sendGetResponse(
             _In_ otai_object_type_t objectType,
             _In_ const std::string& strObjectId,
@@ -217,30 +319,25 @@ namespace syncd
     private:
 
         /**
-         * @brief Syncd mutex for thread synchronization
-         *
-         * Purpose of this mutex is to synchronize multiple threads like
-         * main thread, counters and notifications as well as all
-         * operations which require multiple Redis DB access.
+         * @brief Syncd state lock.
          *
-         * For example: query DB for next VID id number, and then put map
-         * RID and VID to Redis. From syncd point of view this entire
-         * operation should be atomic and no other thread should access DB
-         * or make assumption on previous information until entire
-         * operation will finish.
+         * Held shared by main event loop (ASIC channel and flex counter
+         * events) and by notification processing, so notifications are not
+         * blocked behind vendor calls. Held exclusive by hard and soft
+         * reinit, linecard create/remove and shutdown after exception, which
+         * replace VID/RID maps and counters as a whole.
          *
-         * Mutex must be used in 4 places:
+         * Lock hierarchy, locks are taken only in this order:
          *
-         * - notification processing
-         * - main event loop processing
-         * - syncd hard init when linecards are created
-         *   (notifications could be sent during that)
-         * - in case of exception when sending shutdown request
-         *   (other notifications can still arrive at this point)
+         * - Syncd::m_stateMutex
+         * - VirtualOidTranslator::m_mutex (VID/RID maps, VID allocation)
+         * - RedisClient::m_mutex (ASIC DB connection of client)
+         * - FlexCounterManager::m_mutex, VendorOtai::m_apimutex (leaf locks)
          *
-         * * getting flex counter - here we skip using mutex
+         * Each lock domain uses its own DB connection, since connection can't
+         * be shared between threads.
          */
-        std::mutex m_mutex;
+        std::shared_timed_mutex m_stateMutex;
 
         std::shared_ptr<swss::DBConnector> m_dbAsic;
 
@@ -253,12 +350,68 @@ namespace syncd
 
         std::shared_ptr<NotificationProducerBase> m_notifications;
 
+        /**
+         * @brief Request currently processed, used to report failure of
+         * asynchronous request, otairedis doesn't wait for response then.
+         */
+        std::string m_requestKey;
+
+        std::string m_requestOp;
+
+        /**
+         * @brief Correlation id of current request, echoed in response.
+         */
+        std::string m_requestId;
+
+        bool m_asyncRequest;
+
+        /**
+         * @brief Trace of current request, returned in response when
+         * otairedis asked for it.
+         */
+        otairedis::RequestTrace m_requestTrace;
+
+        bool m_traceRequest;
+
+        /**
+         * @brief When current batch started waiting for state lock and when
+         * it got it.
+         */
+        uint64_t m_lockRequestTime;
+
+        uint64_t m_lockAcquiredTime;
+
         std::shared_ptr<otairedis::RedisVidIndexGenerator> m_redisVidIndexGenerator;
         std::shared_ptr<otairedis::VirtualObjectIdManager> m_virtualObjectIdManager;
 
         std::shared_ptr<swss::DBConnector> m_state_db;
         std::unique_ptr<swss::Table> m_linecardtable;
 
+        /**
+         * @brief Per stage latency of processed requests, published to
+         * STATE_DB on timer.
+         */
+        std::shared_ptr<LatencyStatistics> m_latencyStatistics;
+
+        std::shared_ptr<LatencyStatistics> m_bulkLatencyStatistics;
+
+        std::unique_ptr<swss::Table> m_latencyStatsTable;
+
+        /**
+         * @brief Values of attributes set by syncd, GET of those is answered
+         * without vendor call.
+         */
+        std::shared_ptr<AttributeCache> m_attributeCache;
+
+        std::unique_ptr<swss::Table> m_attributeCacheStatsTable;
+
+        /**
+         * @brief Timer publishing latency and attribute cache statistics.
+         */
+        std::shared_ptr<swss::SelectableTimer> m_statsTimer;
+
+        std::shared_ptr<swss::NotificationConsumer> m_latencyStatsQuery;
+
         otai_oper_status_t m_linecardState;
     };
 }
@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2023 Alibaba Group Holding Limited
+ * Copyright (c) 2023 Accelink Technologies Co., Ltd.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include <chrono>
+
+#include "ChangeFeed.h"
+
+#include "swss/logger.h"
+#include "nlohmann/json.hpp"
+
+using namespace std;
+using namespace syncd;
+
+ChangeFeed::ChangeFeed(
+    _In_ const std::string& dbName,
+    _In_ const std::string& instanceId) :
+    m_instanceId(instanceId)
+{
+    SWSS_LOG_ENTER();
+
+    m_db = std::make_shared<swss::DBConnector>(dbName, 0);
+    m_producer = std::make_shared<swss::NotificationProducer>(m_db.get(), PM_CHANGE_FEED_CHANNEL);
+}
+
+void ChangeFeed::record(
+    _In_ const std::string& table,
+    _In_ const std::string& key,
+    _In_ const std::string& field,
+    _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    m_changes.push_back({table, key, field, value});
+}
+
+void ChangeFeed::publish()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_changes.empty())
+    {
+        return;
+    }
+
+    nlohmann::json j;
+
+    j["time"] = (uint64_t)chrono::duration_cast<chrono::nanoseconds>(chrono::system_clock::now().time_since_epoch()).count();
+
+    nlohmann::json changes = nlohmann::json::array();
+
+    for (auto& c: m_changes)
+    {
+        changes.push_back({{"table", c.m_table}, {"key", c.m_key}, {"field", c.m_field}, {"value", c.m_value}});
+    }
+
+    j["changes"] = changes;
+
+    std::vector<swss::FieldValueTuple> values;
+
+    m_producer->send(m_instanceId, j.dump(), values);
+
+    SWSS_LOG_DEBUG("Published %zu changes of %s", m_changes.size(), m_instanceId.c_str());
+
+    m_changes.clear();
+}
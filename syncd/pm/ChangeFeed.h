@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "swss/sal.h"
+#include "swss/dbconnector.h"
+#include "swss/notificationproducer.h"
+
+/*
+ * Channel carrying per cycle batches of PM/state changes, published on the
+ * database the collectors write to.
+ */
+#define PM_CHANGE_FEED_CHANNEL "PM_CHANGE_FEED"
+
+namespace syncd
+{
+    /*
+     * Collects (table, key, field, value) deltas written by collectors during
+     * one flex counter cycle and publishes them as a single message, so
+     * consumers can subscribe instead of polling the tables.
+     *
+     * Not thread safe, each flex counter lane owns its own feed and records
+     * and publishes from its polling thread only.
+     */
+    class ChangeFeed
+    {
+    public:
+
+        ChangeFeed(
+            _In_ const std::string& dbName,
+            _In_ const std::string& instanceId);
+
+        virtual ~ChangeFeed() = default;
+
+    public:
+
+        void record(
+            _In_ const std::string& table,
+            _In_ const std::string& key,
+            _In_ const std::string& field,
+            _In_ const std::string& value);
+
+        void publish();
+
+    private:
+
+        struct change
+        {
+            std::string m_table;
+
+            std::string m_key;
+
+            std::string m_field;
+
+            std::string m_value;
+        };
+
+        std::string m_instanceId;
+
+        std::vector<change> m_changes;
+
+        std::shared_ptr<swss::DBConnector> m_db;
+
+        std::shared_ptr<swss::NotificationProducer> m_producer;
+    };
+}
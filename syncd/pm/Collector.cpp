@@ -145,6 +145,7 @@ Collector::Collector(
     m_historyTable = unique_ptr<swss::Table>(new swss::Table(m_historyDb.get(), strCountersTable));
 
     m_countersTableName = strCountersTable;
+    m_stateTableName = strStateTable;
 
     swss::DBConnector dbCounters("COUNTERS_DB", 0); 
     std::string strVid = otai_serialize_object_id(vid);
@@ -174,6 +175,66 @@ Collector::~Collector()
     SWSS_LOG_ENTER();
 }
 
+void Collector::setChangeFeed(
+    _In_ std::shared_ptr<ChangeFeed> changeFeed)
+{
+    SWSS_LOG_ENTER();
+
+    m_changeFeed = changeFeed;
+}
+
+void Collector::hsetCounters(
+    _In_ const std::string &key,
+    _In_ const std::string &field,
+    _In_ const std::string &value)
+{
+    SWSS_LOG_ENTER();
+
+    m_countersTable->hset(key, field, value);
+
+    if (m_changeFeed)
+    {
+        m_changeFeed->record(m_countersTableName, key, field, value);
+    }
+}
+
+void Collector::setCounters(
+    _In_ const std::string &key,
+    _In_ const std::vector<swss::FieldValueTuple> &values)
+{
+    SWSS_LOG_ENTER();
+
+    if (values.empty())
+    {
+        return;
+    }
+
+    m_countersTable->set(key, values);
+
+    if (m_changeFeed)
+    {
+        for (auto &fv : values)
+        {
+            m_changeFeed->record(m_countersTableName, key, fvField(fv), fvValue(fv));
+        }
+    }
+}
+
+void Collector::hsetState(
+    _In_ const std::string &key,
+    _In_ const std::string &field,
+    _In_ const std::string &value)
+{
+    SWSS_LOG_ENTER();
+
+    m_stateTable->hset(key, field, value);
+
+    if (m_changeFeed)
+    {
+        m_changeFeed->record(m_stateTableName, key, field, value);
+    }
+}
+
 void Collector::updateTimeFlags()
 {
     SWSS_LOG_ENTER();
@@ -218,3 +279,31 @@ double Collector::convertdBm2MilliWatt(double x)
     return pow(10.0, (x / 10.0));
 }
 
+double Collector::statValueToDouble(
+    _In_ const otai_stat_metadata_t &meta,
+    _In_ const otai_stat_value_t &value)
+{
+    SWSS_LOG_ENTER();
+
+    switch (meta.statvaluetype)
+    {
+        case OTAI_STAT_VALUE_TYPE_UINT32:
+            return (double)value.u32;
+
+        case OTAI_STAT_VALUE_TYPE_INT32:
+            return (double)value.s32;
+
+        case OTAI_STAT_VALUE_TYPE_UINT64:
+            return (double)value.u64;
+
+        case OTAI_STAT_VALUE_TYPE_INT64:
+            return (double)value.s64;
+
+        case OTAI_STAT_VALUE_TYPE_DOUBLE:
+            return value.d64;
+
+        default:
+            return 0;
+    }
+}
+
@@ -8,6 +8,7 @@
 #include "swss/table.h"
 #include "swss/logger.h"
 #include "meta/OtaiInterface.h"
+#include "ChangeFeed.h"
 
 namespace syncd
 {
@@ -39,6 +40,29 @@ namespace syncd
 
         virtual void collect() = 0;
 
+        void setChangeFeed(
+            _In_ std::shared_ptr<ChangeFeed> changeFeed);
+
+    protected:
+
+        /*
+         * Write current value and record it in change feed if enabled, history
+         * records are not part of the feed.
+         */
+        void hsetCounters(
+            _In_ const std::string &key,
+            _In_ const std::string &field,
+            _In_ const std::string &value);
+
+        void hsetState(
+            _In_ const std::string &key,
+            _In_ const std::string &field,
+            _In_ const std::string &value);
+
+        void setCounters(
+            _In_ const std::string &key,
+            _In_ const std::vector<swss::FieldValueTuple> &values);
+
     protected:
 
         otai_object_type_t m_objectType;
@@ -69,6 +93,10 @@ namespace syncd
 
         std::string m_historyTableKeyName;
 
+        std::string m_stateTableName;
+
+        std::shared_ptr<ChangeFeed> m_changeFeed;
+
     protected:
 
         uint64_t m_collectTime;
@@ -87,6 +115,10 @@ namespace syncd
 
         double convertdBm2MilliWatt(double x);
 
+        double statValueToDouble(
+            _In_ const otai_stat_metadata_t &meta,
+            _In_ const otai_stat_value_t &value);
+
         enum validity_type
         {
             VALIDITY_TYPE_COMPLETE,
@@ -143,8 +143,8 @@ void OtaiAttrCollector::updateCurrentValue(entry &e)
 
     if (saveToRedis)
     {
-        m_stateTable->hset(m_stateTableKeyName, otai_serialize_attr_id_kebab_case(*e.m_meta),
-                           otai_serialize_attr_value(*e.m_meta, e.m_attr, false, true));
+        hsetState(m_stateTableKeyName, otai_serialize_attr_id_kebab_case(*e.m_meta),
+                  otai_serialize_attr_value(*e.m_meta, e.m_attr, false, true));
 
         transfer_attributes(m_objectType, 1, &e.m_attr, &e.m_attrdb, false);
     }
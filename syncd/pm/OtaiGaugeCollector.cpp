@@ -21,6 +21,14 @@
 #include "OtaiGaugeCollector.h"
 #include "meta/otai_serialize.h"
 
+#include "swss/tokenize.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
 extern "C" {
 #include "otai.h"
 }
@@ -33,8 +41,11 @@ OtaiGaugeCollector::OtaiGaugeCollector(
             _In_ otai_object_id_t vid,
             _In_ otai_object_id_t rid,
             std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
-            _In_ const std::set<std::string> &strStatIds) :
-            Collector(objectType, vid, rid, vendorOtai)
+            _In_ const std::set<std::string> &strStatIds,
+            _In_ const threshold_map_t &thresholds,
+            _In_ threshold_reporter_t reporter) :
+            Collector(objectType, vid, rid, vendorOtai),
+            m_thresholdReporter(reporter)
 {
     SWSS_LOG_ENTER();
 
@@ -70,16 +81,29 @@ OtaiGaugeCollector::OtaiGaugeCollector(
         e.m_statvalue15min.m_expiretime = EXPIRE_TIME_2_DAYS;
         e.m_statvalue24hour.m_expiretime = EXPIRE_TIME_7_DAYS;
     }    
+
+    setThresholds(thresholds);
 }
 
 OtaiGaugeCollector::~OtaiGaugeCollector()
 {
     SWSS_LOG_ENTER();
 
-    /* clear all gauge data in db */
+    /* clear all gauge data in db and raised threshold alarms */
 
     for (auto &e : m_entries)
     {
+        if (e.m_released)
+        {
+            continue;
+        }
+
+        if (e.m_thresholdState == THRESHOLD_STATE_HIGH ||
+            e.m_thresholdState == THRESHOLD_STATE_LOW)
+        {
+            reportThreshold(e, e.m_thresholdState, false, 0);
+        }
+
         m_countersTable->del(e.m_key15min);
         m_countersTable->del(e.m_key24hour);
 
@@ -88,6 +112,55 @@ OtaiGaugeCollector::~OtaiGaugeCollector()
     }
 }
 
+void OtaiGaugeCollector::adoptState(
+    _Inout_ OtaiGaugeCollector &old)
+{
+    SWSS_LOG_ENTER();
+
+    bool adopted = false;
+
+    for (auto &e : m_entries)
+    {
+        for (auto &o : old.m_entries)
+        {
+            if (o.m_released || o.m_statid != e.m_statid)
+            {
+                continue;
+            }
+
+            e.m_statvalue = o.m_statvalue;
+            e.m_statvalue15min = o.m_statvalue15min;
+            e.m_statvalue24hour = o.m_statvalue24hour;
+
+            if (o.m_hasThreshold == e.m_hasThreshold && o.m_threshold == e.m_threshold)
+            {
+                e.m_thresholdState = o.m_thresholdState;
+            }
+            else if (o.m_thresholdState == THRESHOLD_STATE_HIGH ||
+                     o.m_thresholdState == THRESHOLD_STATE_LOW)
+            {
+                /* threshold changed, clear what was raised against the old one */
+
+                old.reportThreshold(o, o.m_thresholdState, false, 0);
+            }
+
+            o.m_released = true;
+
+            adopted = true;
+
+            break;
+        }
+    }
+
+    if (adopted)
+    {
+        /* continue current bins instead of closing them on first collect */
+
+        m_counter15min = old.m_counter15min;
+        m_counter24hour = old.m_counter24hour;
+    }
+}
+
 void OtaiGaugeCollector::collect()
 {
     SWSS_LOG_ENTER();
@@ -114,7 +187,202 @@ void OtaiGaugeCollector::collect()
 
         updatePeriodicValue(e, STAT_CYCLE_15_MINS);
         updatePeriodicValue(e, STAT_CYCLE_24_HOURS);
+
+        checkThreshold(e);
+    }
+}
+
+bool OtaiGaugeCollector::parseThreshold(
+    _In_ const std::string &value,
+    _Out_ Threshold &threshold)
+{
+    SWSS_LOG_ENTER();
+
+    threshold = Threshold();
+
+    auto tokens = swss::tokenize(value, ',');
+
+    try
+    {
+        if (tokens.size() > 0 && !tokens[0].empty())
+        {
+            threshold.m_hasLow = true;
+            threshold.m_low = std::stod(tokens[0]);
+        }
+
+        if (tokens.size() > 1 && !tokens[1].empty())
+        {
+            threshold.m_hasHigh = true;
+            threshold.m_high = std::stod(tokens[1]);
+        }
+
+        if (tokens.size() > 2 && !tokens[2].empty())
+        {
+            threshold.m_hysteresis = std::stod(tokens[2]);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        SWSS_LOG_ERROR("Invalid threshold '%s': %s", value.c_str(), e.what());
+
+        return false;
+    }
+
+    if (tokens.size() > 3 && !tokens[3].empty())
+    {
+        threshold.m_severity = tokens[3];
+    }
+    else
+    {
+        threshold.m_severity = otai_serialize_enum_v2(OTAI_ALARM_SEVERITY_MINOR, &otai_metadata_enum_otai_alarm_severity_t);
+    }
+
+    if (threshold.m_hysteresis < 0 ||
+        (threshold.m_hasLow && threshold.m_hasHigh && threshold.m_low > threshold.m_high))
+    {
+        SWSS_LOG_ERROR("Invalid threshold '%s'", value.c_str());
+
+        return false;
+    }
+
+    return threshold.m_hasLow || threshold.m_hasHigh;
+}
+
+void OtaiGaugeCollector::setThresholds(
+    _In_ const threshold_map_t &thresholds)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto &e : m_entries)
+    {
+        auto it = thresholds.find(otai_serialize_stat_id(*e.m_meta));
+
+        bool hasThreshold = (it != thresholds.end());
+
+        if (hasThreshold == e.m_hasThreshold &&
+            (!hasThreshold || it->second == e.m_threshold))
+        {
+            continue;
+        }
+
+        /* threshold changed, clear what was raised against the old one */
+
+        if (e.m_thresholdState == THRESHOLD_STATE_HIGH ||
+            e.m_thresholdState == THRESHOLD_STATE_LOW)
+        {
+            reportThreshold(e, e.m_thresholdState, false, 0);
+        }
+
+        e.m_hasThreshold = hasThreshold;
+        e.m_threshold = hasThreshold ? it->second : Threshold();
+        e.m_thresholdState = THRESHOLD_STATE_UNKNOWN;
+    }
+}
+
+void OtaiGaugeCollector::checkThreshold(entry &e)
+{
+    SWSS_LOG_ENTER();
+
+    if (!e.m_hasThreshold || m_thresholdReporter == nullptr)
+    {
+        return;
+    }
+
+    const Threshold &t = e.m_threshold;
+
+    double value = statValueToDouble(*e.m_meta, e.m_statvalue);
+
+    if (e.m_thresholdState == THRESHOLD_STATE_HIGH && value <= t.m_high - t.m_hysteresis)
+    {
+        reportThreshold(e, THRESHOLD_STATE_HIGH, false, value);
+        e.m_thresholdState = THRESHOLD_STATE_NORMAL;
+    }
+    else if (e.m_thresholdState == THRESHOLD_STATE_LOW && value >= t.m_low + t.m_hysteresis)
+    {
+        reportThreshold(e, THRESHOLD_STATE_LOW, false, value);
+        e.m_thresholdState = THRESHOLD_STATE_NORMAL;
+    }
+
+    if (e.m_thresholdState == THRESHOLD_STATE_HIGH ||
+        e.m_thresholdState == THRESHOLD_STATE_LOW)
+    {
+        return;
+    }
+
+    ThresholdState state = THRESHOLD_STATE_NORMAL;
+
+    if (t.m_hasHigh && value > t.m_high)
+    {
+        state = THRESHOLD_STATE_HIGH;
+    }
+    else if (t.m_hasLow && value < t.m_low)
+    {
+        state = THRESHOLD_STATE_LOW;
+    }
+
+    if (state != THRESHOLD_STATE_NORMAL)
+    {
+        reportThreshold(e, state, true, value);
     }
+    else if (e.m_thresholdState == THRESHOLD_STATE_UNKNOWN)
+    {
+        /*
+         * First sample after start or reconfiguration, alarms raised before
+         * syncd restart may still be present in CURALARM.
+         */
+
+        if (t.m_hasHigh)
+        {
+            reportThreshold(e, THRESHOLD_STATE_HIGH, false, value);
+        }
+
+        if (t.m_hasLow)
+        {
+            reportThreshold(e, THRESHOLD_STATE_LOW, false, value);
+        }
+    }
+
+    e.m_thresholdState = state;
+}
+
+void OtaiGaugeCollector::reportThreshold(entry &e, ThresholdState state, bool active, double value)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_thresholdReporter == nullptr)
+    {
+        return;
+    }
+
+    std::string name = otai_serialize_stat_id(*e.m_meta);
+
+    auto pos = name.find("_STAT_");
+
+    if (pos != std::string::npos)
+    {
+        name = name.substr(pos + strlen("_STAT_"));
+    }
+
+    bool high = (state == THRESHOLD_STATE_HIGH);
+
+    std::string typeId = name + (high ? "_HIGH_THRESHOLD" : "_LOW_THRESHOLD");
+
+    std::stringstream text;
+
+    text << std::fixed << std::setprecision(2)
+         << otai_serialize_stat_id_camel_case(*e.m_meta) << " "
+         << value << (high ? " above high threshold " : " below low threshold ")
+         << (high ? e.m_threshold.m_high : e.m_threshold.m_low);
+
+    uint64_t timeCreated = m_collectTime;
+
+    if (!active)
+    {
+        timeCreated = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    m_thresholdReporter(m_rid, typeId, e.m_threshold.m_severity, text.str(), timeCreated, active);
 }
 
 void OtaiGaugeCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
@@ -162,12 +430,20 @@ void OtaiGaugeCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
             m_historyTable->hset(historyKey, "min-time", to_string(v.m_mintime));
             m_historyTable->hset(historyKey, "avg", otai_serialize_stat_value(*e.m_meta, v.m_avgvalue));
             m_historyTable->hset(historyKey, "instant", otai_serialize_stat_value(*e.m_meta, v.m_instantvalue));
+
+            if (!v.m_sketch.empty())
+            {
+                m_historyTable->hset(historyKey, "p50", serializeQuantile(e, v.m_sketch.quantile(0.50)));
+                m_historyTable->hset(historyKey, "p95", serializeQuantile(e, v.m_sketch.quantile(0.95)));
+                m_historyTable->hset(historyKey, "p99", serializeQuantile(e, v.m_sketch.quantile(0.99)));
+            }
+
             m_historyTable->expire(historyKey, v.m_expiretime);
         }
         else
         {
             v.m_init = false;
-            m_countersTable->hset(key, "interval", to_string(v.m_interval));
+            hsetCounters(key, "interval", to_string(v.m_interval));
         }
 
         v.m_failurecount = 0;
@@ -204,19 +480,22 @@ void OtaiGaugeCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
 
         v.m_accnum = 1;
 
-        m_countersTable->hset(key, "starttime", to_string(v.m_starttime));
-        m_countersTable->hset(key, "max", otai_serialize_stat_value(*e.m_meta, v.m_maxvalue));
-        m_countersTable->hset(key, "max-time", to_string(v.m_maxtime));
-        m_countersTable->hset(key, "min", otai_serialize_stat_value(*e.m_meta, v.m_minvalue));
-        m_countersTable->hset(key, "min-time", to_string(v.m_mintime));
-        m_countersTable->hset(key, "instant", otai_serialize_stat_value(*e.m_meta, v.m_instantvalue));
-        m_countersTable->hset(key, "avg", otai_serialize_stat_value(*e.m_meta, v.m_avgvalue));
+        hsetCounters(key, "starttime", to_string(v.m_starttime));
+        hsetCounters(key, "max", otai_serialize_stat_value(*e.m_meta, v.m_maxvalue));
+        hsetCounters(key, "max-time", to_string(v.m_maxtime));
+        hsetCounters(key, "min", otai_serialize_stat_value(*e.m_meta, v.m_minvalue));
+        hsetCounters(key, "min-time", to_string(v.m_mintime));
+        hsetCounters(key, "instant", otai_serialize_stat_value(*e.m_meta, v.m_instantvalue));
+        hsetCounters(key, "avg", otai_serialize_stat_value(*e.m_meta, v.m_avgvalue));
 
         v.m_currentValidityType = VALIDITY_TYPE_COMPLETE;
-        m_countersTable->hset(key, "current_validity", validityToString(v.m_currentValidityType));
+        hsetCounters(key, "current_validity", validityToString(v.m_currentValidityType));
 
         v.m_validityType = VALIDITY_TYPE_INCOMPLETE;
-        m_countersTable->hset(key, "validity", validityToString(v.m_validityType));
+        hsetCounters(key, "validity", validityToString(v.m_validityType));
+
+        v.m_sketch.clear();
+        updateQuantiles(e, v, key, true);
 
         return;
     }
@@ -226,8 +505,8 @@ void OtaiGaugeCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
         transfer_stat(*e.m_meta, e.m_statvalue, v.m_maxvalue);
         v.m_maxtime = m_collectTime;
 
-        m_countersTable->hset(key, "max", otai_serialize_stat_value(*e.m_meta, v.m_maxvalue));
-        m_countersTable->hset(key, "max-time", to_string(v.m_maxtime));
+        hsetCounters(key, "max", otai_serialize_stat_value(*e.m_meta, v.m_maxvalue));
+        hsetCounters(key, "max-time", to_string(v.m_maxtime));
     }
 
     if (compare_stats(m_objectType, e.m_statid, e.m_statvalue, v.m_minvalue) < 0)
@@ -235,15 +514,15 @@ void OtaiGaugeCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
         transfer_stat(*e.m_meta, e.m_statvalue, v.m_minvalue);
         v.m_mintime = m_collectTime;
 
-        m_countersTable->hset(key, "min", otai_serialize_stat_value(*e.m_meta, v.m_minvalue));
-        m_countersTable->hset(key, "min-time", to_string(v.m_mintime));
+        hsetCounters(key, "min", otai_serialize_stat_value(*e.m_meta, v.m_minvalue));
+        hsetCounters(key, "min-time", to_string(v.m_mintime));
     }
 
     if (compare_stats(m_objectType, e.m_statid, e.m_statvalue, v.m_instantvalue))
     {
         transfer_stat(*e.m_meta, e.m_statvalue, v.m_instantvalue);
 
-        m_countersTable->hset(key, "instant", otai_serialize_stat_value(*e.m_meta, v.m_instantvalue));
+        hsetCounters(key, "instant", otai_serialize_stat_value(*e.m_meta, v.m_instantvalue));
     }
 
     otai_stat_value_t avgvalue;
@@ -265,7 +544,75 @@ void OtaiGaugeCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
     if (compare_stats(m_objectType, e.m_statid, avgvalue, v.m_avgvalue))
     {
         transfer_stat(*e.m_meta, avgvalue, v.m_avgvalue);
-        m_countersTable->hset(key, "avg", otai_serialize_stat_value(*e.m_meta, v.m_avgvalue));
+        hsetCounters(key, "avg", otai_serialize_stat_value(*e.m_meta, v.m_avgvalue));
+    }
+
+    updateQuantiles(e, v, key, false);
+}
+
+void OtaiGaugeCollector::updateQuantiles(entry &e, AvgMinMaxValue &v, const std::string &key, bool force)
+{
+    SWSS_LOG_ENTER();
+
+    static const double quantiles[] = { 0.50, 0.95, 0.99 };
+    static const char* fields[] = { "p50", "p95", "p99" };
+
+    bool dbm = (e.m_meta->statvalueunit == OTAI_STAT_VALUE_UNIT_DBM &&
+                e.m_meta->statvaluetype == OTAI_STAT_VALUE_TYPE_DOUBLE);
+
+    /* same as average, quantiles of dBm values are computed in miliwatt */
+
+    double sample = statValueToDouble(*e.m_meta, e.m_statvalue);
+
+    v.m_sketch.add(dbm ? convertdBm2MilliWatt(sample) : sample);
+
+    for (size_t i = 0; i < sizeof(quantiles) / sizeof(quantiles[0]); i++)
+    {
+        double q = v.m_sketch.quantile(quantiles[i]);
+
+        if (!force && q == v.m_quantiledb[i])
+        {
+            continue;
+        }
+
+        v.m_quantiledb[i] = q;
+
+        hsetCounters(key, fields[i], serializeQuantile(e, q));
     }
 }
 
+std::string OtaiGaugeCollector::serializeQuantile(entry &e, double value)
+{
+    SWSS_LOG_ENTER();
+
+    otai_stat_value_t v;
+
+    switch (e.m_meta->statvaluetype)
+    {
+        case OTAI_STAT_VALUE_TYPE_UINT32:
+            v.u32 = (uint32_t)std::llround(value);
+            break;
+
+        case OTAI_STAT_VALUE_TYPE_INT32:
+            v.s32 = (int32_t)std::llround(value);
+            break;
+
+        case OTAI_STAT_VALUE_TYPE_UINT64:
+            v.u64 = (uint64_t)std::llround(value);
+            break;
+
+        case OTAI_STAT_VALUE_TYPE_INT64:
+            v.s64 = (int64_t)std::llround(value);
+            break;
+
+        case OTAI_STAT_VALUE_TYPE_DOUBLE:
+            v.d64 = (e.m_meta->statvalueunit == OTAI_STAT_VALUE_UNIT_DBM) ? convertMilliWatt2dBm(value) : value;
+            break;
+
+        default:
+            return "";
+    }
+
+    return otai_serialize_stat_value(*e.m_meta, v);
+}
+
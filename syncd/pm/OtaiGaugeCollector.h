@@ -3,13 +3,69 @@
 #include <vector>
 #include <string>
 #include <set>
+#include <map>
+#include <functional>
 
 #include "Collector.h"
+#include "QuantileSketch.h"
 
 namespace syncd
 {
     class OtaiGaugeCollector : public Collector
     {
+    public:
+
+        /*
+         * High/low threshold of a gauge, in the unit the stat is reported in
+         * (dBm for optical power). An alarm raised on crossing a threshold is
+         * cleared only after the value moved back by the hysteresis.
+         */
+        struct Threshold
+        {
+            bool m_hasLow = false;
+
+            bool m_hasHigh = false;
+
+            double m_low = 0;
+
+            double m_high = 0;
+
+            double m_hysteresis = 0;
+
+            std::string m_severity;
+
+            bool operator==(const Threshold &other) const
+            {
+                return m_hasLow == other.m_hasLow && m_hasHigh == other.m_hasHigh &&
+                       m_low == other.m_low && m_high == other.m_high &&
+                       m_hysteresis == other.m_hysteresis && m_severity == other.m_severity;
+            }
+
+            bool operator!=(const Threshold &other) const
+            {
+                return !(*this == other);
+            }
+        };
+
+        // key is stat id name, e.g. OTAI_PORT_STAT_INPUT_POWER
+        typedef std::map<std::string, Threshold> threshold_map_t;
+
+        typedef std::function<void(
+            _In_ otai_object_id_t rid,
+            _In_ const std::string &typeId,
+            _In_ const std::string &severity,
+            _In_ const std::string &text,
+            _In_ uint64_t timeCreated,
+            _In_ bool active)> threshold_reporter_t;
+
+        /*
+         * Parse "low,high[,hysteresis[,severity]]", empty low or high means
+         * this side is not monitored.
+         */
+        static bool parseThreshold(
+            _In_ const std::string &value,
+            _Out_ Threshold &threshold);
+
     public:
 
         OtaiGaugeCollector(
@@ -17,14 +73,36 @@ namespace syncd
             _In_ otai_object_id_t vid,
             _In_ otai_object_id_t rid,
             std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
-            _In_ const std::set<std::string> &strStatIds);
+            _In_ const std::set<std::string> &strStatIds,
+            _In_ const threshold_map_t &thresholds = threshold_map_t(),
+            _In_ threshold_reporter_t reporter = nullptr);
 
         ~OtaiGaugeCollector();
 
         void collect();
 
+        void setThresholds(
+            _In_ const threshold_map_t &thresholds);
+
+        /*
+         * Take over PM bins and threshold state of gauges moved from old
+         * collector of the same object (e.g. between bulk and high priority
+         * lane). Old collector leaves counters and alarms of taken gauges
+         * untouched when destroyed.
+         */
+        void adoptState(
+            _Inout_ OtaiGaugeCollector &old);
+
     private:
 
+        enum ThresholdState
+        {
+            THRESHOLD_STATE_UNKNOWN,
+            THRESHOLD_STATE_NORMAL,
+            THRESHOLD_STATE_HIGH,
+            THRESHOLD_STATE_LOW,
+        };
+
         struct AvgMinMaxValue
         {
             bool m_init;
@@ -54,6 +132,11 @@ namespace syncd
 
             uint64_t m_failurecount;
 
+            // p50/p95/p99 of the samples in the bin
+            QuantileSketch m_sketch;
+
+            double m_quantiledb[3];
+
             AvgMinMaxValue()
             {
                 m_accnum = 0;
@@ -82,8 +165,17 @@ namespace syncd
 
             std::string m_historyKey24hour;
 
+            bool m_hasThreshold;
+
+            Threshold m_threshold;
+
+            ThresholdState m_thresholdState;
+
+            // state taken over by another collector
+            bool m_released;
+
             entry(const otai_stat_metadata_t *meta, std::string &tableKeyName)
-                : m_meta(meta)
+                : m_meta(meta), m_hasThreshold(false), m_thresholdState(THRESHOLD_STATE_UNKNOWN), m_released(false)
             {
                 m_statid = meta->statid;
 
@@ -102,6 +194,16 @@ namespace syncd
            
         void updatePeriodicValue(entry &e, StatisticalCycle cycle); 
 
+        void checkThreshold(entry &e);
+
+        void updateQuantiles(entry &e, AvgMinMaxValue &v, const std::string &key, bool force);
+
+        std::string serializeQuantile(entry &e, double value);
+
+        void reportThreshold(entry &e, ThresholdState state, bool active, double value);
+
+        threshold_reporter_t m_thresholdReporter;
+
     };
 }
 
@@ -17,6 +17,7 @@
  */
 
 #include <inttypes.h>
+#include <cmath>
 
 #include "OtaiStatCollector.h"
 #include "meta/otai_serialize.h"
@@ -33,7 +34,8 @@ OtaiStatCollector::OtaiStatCollector(
         _In_ otai_object_id_t vid,
         _In_ otai_object_id_t rid,
         std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
-        _In_ const std::set<std::string> &strStatIds) :
+        _In_ const std::set<std::string> &strStatIds,
+        _In_ const std::vector<uint32_t> &rateWindows) :
         Collector(objectType, vid, rid, vendorOtai)
 {
     SWSS_LOG_ENTER();
@@ -77,7 +79,10 @@ OtaiStatCollector::OtaiStatCollector(
 
     m_historyKey15min = m_historyTableKeyName + ":15_pm_history_";
     m_historyKey24hour = m_historyTableKeyName + ":24_pm_history_";
-    
+
+    m_keyRate = m_countersTableKeyName + ":rate";
+
+    setRateWindows(rateWindows);
 }
 
 OtaiStatCollector::~OtaiStatCollector()
@@ -89,6 +94,7 @@ OtaiStatCollector::~OtaiStatCollector()
     m_countersTable->del(m_keyCur);
     m_countersTable->del(m_key15min);
     m_countersTable->del(m_key24hour);
+    m_countersTable->del(m_keyRate);
 
     SWSS_LOG_NOTICE("Clear counter data, table:%s,%s,%s",
                     m_keyCur.c_str(), m_key15min.c_str(), m_key24hour.c_str());
@@ -102,6 +108,8 @@ void OtaiStatCollector::collect()
 
     updateTimeFlags();
 
+    std::vector<swss::FieldValueTuple> rates;
+
     for (auto &e : m_entries)
     {
         status = m_vendorOtai->getStats(m_objectType,
@@ -110,11 +118,18 @@ void OtaiStatCollector::collect()
                                        &e.m_statid,
                                        &e.m_statvalue);
 
+        // timestamp of this read, not of the cycle, so rates are exact
+        // even if previous vendor calls in this cycle were slow
+        auto readtime = std::chrono::steady_clock::now();
+
         if (status != OTAI_STATUS_SUCCESS)
         {
             e.m_accvalue15min.m_failurecount++;
             e.m_accvalue24hour.m_failurecount++;
 
+            // counts of this interval are unknown, restart rate tracking
+            e.m_hasReadtime = false;
+
             continue;
         }
 
@@ -122,6 +137,97 @@ void OtaiStatCollector::collect()
         updatePeriodicValue(e, STAT_CYCLE_15_MINS);
         updatePeriodicValue(e, STAT_CYCLE_24_HOURS);
 
+        updateRates(e, readtime, rates);
+    }
+
+    setCounters(m_keyRate, rates);
+}
+
+void OtaiStatCollector::setRateWindows(
+    _In_ const std::vector<uint32_t> &rateWindows)
+{
+    SWSS_LOG_ENTER();
+
+    if (rateWindows == m_rateWindows)
+    {
+        return;
+    }
+
+    m_rateWindows = rateWindows;
+
+    for (auto &e : m_entries)
+    {
+        e.m_hasReadtime = false;
+        e.m_rates.assign(m_rateWindows.size(), 0);
+        e.m_ratesdb.assign(m_rateWindows.size(), "");
+    }
+
+    m_countersTable->del(m_keyRate);
+}
+
+void OtaiStatCollector::updateRates(
+    _In_ entry &e,
+    _In_ std::chrono::steady_clock::time_point readtime,
+    _Inout_ std::vector<swss::FieldValueTuple> &values)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_rateWindows.empty())
+    {
+        return;
+    }
+
+    bool hasReadtime = e.m_hasReadtime;
+    auto prevReadtime = e.m_readtime;
+
+    e.m_hasReadtime = true;
+    e.m_readtime = readtime;
+
+    if (!hasReadtime)
+    {
+        return;
+    }
+
+    double dt = std::chrono::duration<double>(readtime - prevReadtime).count();
+
+    if (dt <= 0)
+    {
+        return;
+    }
+
+    /*
+     * OTAI clears counters on read, so the value read is the increment since
+     * previous read.
+     */
+
+    double rate = statValueToDouble(*e.m_meta, e.m_statvalue) / dt;
+
+    std::string name = otai_serialize_stat_id_kebab_case(*e.m_meta);
+
+    for (size_t i = 0; i < m_rateWindows.size(); i++)
+    {
+        if (e.m_ratesdb[i].empty())
+        {
+            // first rate of this entry, seed average with it
+            e.m_rates[i] = rate;
+        }
+        else
+        {
+            double alpha = 1.0 - std::exp(-dt / (double)m_rateWindows[i]);
+
+            e.m_rates[i] += alpha * (rate - e.m_rates[i]);
+        }
+
+        std::string value = otai_serialize_decimal(e.m_rates[i]);
+
+        if (value == e.m_ratesdb[i])
+        {
+            continue;
+        }
+
+        e.m_ratesdb[i] = value;
+
+        values.emplace_back(name + "-rate-" + std::to_string(m_rateWindows[i]) + "s", value);
     }
 }
 
@@ -156,8 +262,8 @@ void OtaiStatCollector::updateCurrentValue(entry &e)
 
     if (saveToRedis)
     {
-        m_countersTable->hset(m_keyCur, otai_serialize_stat_id_kebab_case(*e.m_meta),
-                              otai_serialize_stat_value(*e.m_meta, v.m_stataccvalue));
+        hsetCounters(m_keyCur, otai_serialize_stat_id_kebab_case(*e.m_meta),
+                     otai_serialize_stat_value(*e.m_meta, v.m_stataccvalue));
         transfer_stat(*e.m_meta, v.m_stataccvalue, v.m_statvaluedb);
     }
 }
@@ -206,7 +312,7 @@ void OtaiStatCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
         }
         else
         {
-            m_countersTable->hset(key,  "interval", to_string(accvalue.m_interval));
+            hsetCounters(key,  "interval", to_string(accvalue.m_interval));
             accvalue.m_init = false;
         }
 
@@ -221,17 +327,17 @@ void OtaiStatCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
             accvalue.m_starttime = m_counter24hour * PM_CYCLE_24_HOURS;
         }
 
-        m_countersTable->hset(key, "starttime", to_string(accvalue.m_starttime));
+        hsetCounters(key, "starttime", to_string(accvalue.m_starttime));
 
         transfer_stat(*e.m_meta, e.m_statvalue, accvalue.m_stataccvalue);
 
-        m_countersTable->hset(key, otai_serialize_stat_id_kebab_case(*e.m_meta),
-                              otai_serialize_stat_value(*e.m_meta, accvalue.m_stataccvalue));
+        hsetCounters(key, otai_serialize_stat_id_kebab_case(*e.m_meta),
+                     otai_serialize_stat_value(*e.m_meta, accvalue.m_stataccvalue));
 
         transfer_stat(*e.m_meta, accvalue.m_stataccvalue, accvalue.m_statvaluedb); 
 
         accvalue.m_validityType = VALIDITY_TYPE_INCOMPLETE;
-        m_countersTable->hset(key, "validity", validityToString(accvalue.m_validityType));
+        hsetCounters(key, "validity", validityToString(accvalue.m_validityType));
 
         return;
     }
@@ -240,8 +346,8 @@ void OtaiStatCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
 
     if (compare_stats(m_objectType, e.m_statid, accvalue.m_stataccvalue, accvalue.m_statvaluedb))
     {
-        m_countersTable->hset(key, otai_serialize_stat_id_kebab_case(*e.m_meta),
-                              otai_serialize_stat_value(*e.m_meta, accvalue.m_stataccvalue));
+        hsetCounters(key, otai_serialize_stat_id_kebab_case(*e.m_meta),
+                     otai_serialize_stat_value(*e.m_meta, accvalue.m_stataccvalue));
 
         transfer_stat(*e.m_meta, accvalue.m_stataccvalue, accvalue.m_statvaluedb);
     }
@@ -3,6 +3,7 @@
 #include <vector>
 #include <string>
 #include <set>
+#include <chrono>
 
 #include "Collector.h"
 
@@ -17,12 +18,20 @@ namespace syncd
             _In_ otai_object_id_t vid,
             _In_ otai_object_id_t rid,
             std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
-            _In_ const std::set<std::string> &strStatIds);
+            _In_ const std::set<std::string> &strStatIds,
+            _In_ const std::vector<uint32_t> &rateWindows = std::vector<uint32_t>());
 
         ~OtaiStatCollector();
 
         void collect();
 
+        /*
+         * EWMA windows in seconds of the per second rates published in
+         * <name>:rate, empty disables rates.
+         */
+        void setRateWindows(
+            _In_ const std::vector<uint32_t> &rateWindows);
+
     private:
 
         struct AccumulativeValue
@@ -67,8 +76,17 @@ namespace syncd
 
             AccumulativeValue m_accvalue24hour;
 
+            // time of previous successful vendor read, rates need two reads
+            std::chrono::steady_clock::time_point m_readtime;
+
+            bool m_hasReadtime;
+
+            std::vector<double> m_rates;
+
+            std::vector<std::string> m_ratesdb;
+
             entry(const otai_stat_metadata_t *meta)
-                : m_meta(meta)
+                : m_meta(meta), m_hasReadtime(false)
             {
                 m_statid = meta->statid;
             }
@@ -86,8 +104,17 @@ namespace syncd
 
         std::string m_historyKey24hour;
 
+        std::string m_keyRate;
+
+        std::vector<uint32_t> m_rateWindows;
+
         void updateCurrentValue(entry &e);
 
+        void updateRates(
+            _In_ entry &e,
+            _In_ std::chrono::steady_clock::time_point readtime,
+            _Inout_ std::vector<swss::FieldValueTuple> &values);
+
         void updatePeriodicValue(entry &e, StatisticalCycle cycle);
 
     };
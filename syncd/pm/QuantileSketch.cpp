@@ -0,0 +1,287 @@
+/**
+ * Copyright (c) 2023 Alibaba Group Holding Limited
+ * Copyright (c) 2023 Accelink Technologies Co., Ltd.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "QuantileSketch.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+/*
+ * gamma = (1 + alpha) / (1 - alpha), bin i holds values in
+ * (gamma^(i-1), gamma^i].
+ */
+static const double g_gamma = (1 + QUANTILE_SKETCH_RELATIVE_ACCURACY) / (1 - QUANTILE_SKETCH_RELATIVE_ACCURACY);
+static const double g_logGamma = std::log(g_gamma);
+
+// values with smaller magnitude are counted as zero
+#define QUANTILE_SKETCH_MIN_VALUE (1e-300)
+
+#define QUANTILE_SKETCH_MAX_COUNT (0xffff)
+
+void QuantileSketch::Store::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_offset = 0;
+    m_empty = true;
+
+    memset(m_bins, 0, sizeof(m_bins));
+}
+
+bool QuantileSketch::Store::add(
+    _In_ int32_t index)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_empty)
+    {
+        // start in the middle, so window can grow both ways without shifting
+
+        m_offset = index - QUANTILE_SKETCH_BINS / 2;
+        m_empty = false;
+    }
+
+    if (index >= m_offset + QUANTILE_SKETCH_BINS)
+    {
+        // shift window up, bins falling below the window collapse into
+        // the lowest bin
+
+        int32_t shift = index - (m_offset + QUANTILE_SKETCH_BINS - 1);
+
+        uint32_t collapsed = 0;
+
+        for (int i = 0; i < QUANTILE_SKETCH_BINS; i++)
+        {
+            if (i <= shift)
+            {
+                collapsed += m_bins[i];
+            }
+            else
+            {
+                m_bins[i - shift] = m_bins[i];
+            }
+        }
+
+        for (int i = std::max(0, QUANTILE_SKETCH_BINS - shift); i < QUANTILE_SKETCH_BINS; i++)
+        {
+            m_bins[i] = 0;
+        }
+
+        m_offset += shift;
+
+        m_bins[0] = (uint16_t)std::min<uint32_t>(collapsed, QUANTILE_SKETCH_MAX_COUNT);
+    }
+    else if (index < m_offset)
+    {
+        int32_t top = QUANTILE_SKETCH_BINS - 1;
+
+        while (top >= 0 && m_bins[top] == 0)
+        {
+            top--;
+        }
+
+        int32_t shift = m_offset - index;
+
+        if (top + shift < QUANTILE_SKETCH_BINS)
+        {
+            // enough empty bins on top, shift window down
+
+            for (int32_t i = top; i >= 0; i--)
+            {
+                m_bins[i + shift] = m_bins[i];
+            }
+
+            for (int32_t i = 0; i < shift && i < QUANTILE_SKETCH_BINS; i++)
+            {
+                m_bins[i] = 0;
+            }
+
+            m_offset = index;
+        }
+        else
+        {
+            // collapse into lowest bin
+
+            index = m_offset;
+        }
+    }
+
+    uint16_t &bin = m_bins[index - m_offset];
+
+    if (bin == QUANTILE_SKETCH_MAX_COUNT)
+    {
+        return false;
+    }
+
+    bin++;
+
+    return true;
+}
+
+QuantileSketch::QuantileSketch()
+{
+    SWSS_LOG_ENTER();
+
+    clear();
+}
+
+void QuantileSketch::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_positive.clear();
+    m_negative.clear();
+
+    m_zeroCount = 0;
+    m_count = 0;
+}
+
+bool QuantileSketch::empty() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count == 0;
+}
+
+int32_t QuantileSketch::index(
+    _In_ double value) const
+{
+    SWSS_LOG_ENTER();
+
+    return (int32_t)std::ceil(std::log(value) / g_logGamma);
+}
+
+double QuantileSketch::value(
+    _In_ int32_t index) const
+{
+    SWSS_LOG_ENTER();
+
+    // middle of the bin, relative error at most alpha
+
+    return 2 * std::pow(g_gamma, index) / (g_gamma + 1);
+}
+
+void QuantileSketch::halve()
+{
+    SWSS_LOG_ENTER();
+
+    m_count = 0;
+
+    for (int i = 0; i < QUANTILE_SKETCH_BINS; i++)
+    {
+        // round up, so populated bins stay populated
+
+        m_positive.m_bins[i] = (uint16_t)((m_positive.m_bins[i] + 1) / 2);
+        m_negative.m_bins[i] = (uint16_t)((m_negative.m_bins[i] + 1) / 2);
+
+        m_count += m_positive.m_bins[i] + m_negative.m_bins[i];
+    }
+
+    m_zeroCount = (m_zeroCount + 1) / 2;
+
+    m_count += m_zeroCount;
+}
+
+void QuantileSketch::add(
+    _In_ double v)
+{
+    SWSS_LOG_ENTER();
+
+    if (std::isnan(v))
+    {
+        return;
+    }
+
+    if (std::fabs(v) < QUANTILE_SKETCH_MIN_VALUE)
+    {
+        if (m_zeroCount == QUANTILE_SKETCH_MAX_COUNT)
+        {
+            halve();
+        }
+
+        m_zeroCount++;
+    }
+    else
+    {
+        Store &store = (v > 0) ? m_positive : m_negative;
+
+        int32_t i = index(std::fabs(v));
+
+        if (!store.add(i))
+        {
+            halve();
+
+            store.add(i);
+        }
+    }
+
+    m_count++;
+}
+
+double QuantileSketch::quantile(
+    _In_ double q) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_count == 0)
+    {
+        return 0;
+    }
+
+    q = std::min(std::max(q, 0.0), 1.0);
+
+    double rank = q * (m_count - 1);
+
+    uint64_t n = 0;
+
+    // negative values, from the largest magnitude
+
+    for (int i = QUANTILE_SKETCH_BINS - 1; i >= 0; i--)
+    {
+        n += m_negative.m_bins[i];
+
+        if (n > rank)
+        {
+            return -value(m_negative.m_offset + i);
+        }
+    }
+
+    n += m_zeroCount;
+
+    if (n > rank)
+    {
+        return 0;
+    }
+
+    for (int i = 0; i < QUANTILE_SKETCH_BINS; i++)
+    {
+        n += m_positive.m_bins[i];
+
+        if (n > rank)
+        {
+            return value(m_positive.m_offset + i);
+        }
+    }
+
+    return value(m_positive.m_offset + QUANTILE_SKETCH_BINS - 1);
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <cstdint>
+
+namespace syncd
+{
+    /*
+     * Bounded memory quantile sketch (DDSketch style) for gauge values.
+     *
+     * Values are mapped to logarithmic bins with a relative accuracy of
+     * QUANTILE_SKETCH_RELATIVE_ACCURACY, positive and negative values are
+     * kept in separate stores of QUANTILE_SKETCH_BINS counters each. When a
+     * store would need more bins, bins closest to zero are collapsed, so the
+     * tails used for p95/p99 keep their accuracy. When a counter saturates
+     * all counters are halved, which keeps the distribution shape.
+     *
+     * 32 bins of 8% accuracy cover values spanning about two orders of
+     * magnitude before any collapse, which fits gauge range within one PM
+     * bin. Adding a sample is O(1) except for the rare window shift, the
+     * whole sketch is 152 bytes, two per gauge (15 minute and 24 hour).
+     */
+
+#define QUANTILE_SKETCH_BINS                (32)
+#define QUANTILE_SKETCH_RELATIVE_ACCURACY   (0.08)
+
+    class QuantileSketch
+    {
+    public:
+
+        QuantileSketch();
+
+    public:
+
+        void add(
+            _In_ double value);
+
+        void clear();
+
+        bool empty() const;
+
+        /*
+         * Return estimated value at quantile q (0..1), 0 if sketch is empty.
+         */
+        double quantile(
+            _In_ double q) const;
+
+    private:
+
+        struct Store
+        {
+            int32_t m_offset;
+
+            bool m_empty;
+
+            uint16_t m_bins[QUANTILE_SKETCH_BINS];
+
+            void clear();
+
+            bool add(
+                _In_ int32_t index);
+        };
+
+        int32_t index(
+            _In_ double value) const;
+
+        double value(
+            _In_ int32_t index) const;
+
+        void halve();
+
+    private:
+
+        Store m_positive;
+
+        Store m_negative;
+
+        uint32_t m_zeroCount;
+
+        uint32_t m_count;
+    };
+}